@@ -5,8 +5,12 @@
 #include <cmath>
 #include <algorithm>
 #include <chrono>
+#include <iterator>
+#include <utility>
 #include "LinkedList.hpp"
 #include "Array.hpp"
+#include "SegmentedArray.hpp"
+#include "IndexSort.hpp"
 
 template<typename T>
 class SortingAlgorithms {
@@ -22,18 +26,28 @@ private:
         return arr;
     }
 
-    // Helper function for quicksort
+    // Relinks the list's nodes in the order of arr; no element is moved
+    static void relink(LinkedList<T>& list, Node<T>** arr, int n) {
+        for (int i = 0; i + 1 < n; i++) {
+            arr[i]->next = arr[i + 1];
+        }
+        arr[n - 1]->next = nullptr;
+        list.setHead(arr[0]);
+    }
+
+    // Helper function for quicksort; swaps node pointers, not elements
     static int partition(Node<T>** arr, int low, int high) {
-        T pivot = arr[high]->data;
+        // arr[high] is not touched until the final swap, so no copy is needed
+        const T& pivot = arr[high]->data;
         int i = (low - 1);
 
         for (int j = low; j <= high - 1; j++) {
             if (!(arr[j]->data > pivot)) {
                 i++;
-                std::swap(arr[i]->data, arr[j]->data);
+                std::swap(arr[i], arr[j]);
             }
         }
-        std::swap(arr[i + 1]->data, arr[high]->data);
+        std::swap(arr[i + 1], arr[high]);
         return (i + 1);
     }
 
@@ -106,6 +120,7 @@ public:
 
         Node<T>** arr = createNodeArray(list, n);
         quickSortHelper(arr, 0, n - 1);
+        relink(list, arr, n);
         delete[] arr;
     }
 
@@ -116,14 +131,7 @@ public:
 
         Node<T>** arr = createNodeArray(list, n);
         mergeSortHelper(arr, 0, n - 1);
-        
-        // Update the linked list with sorted values
-        Node<T>* current = list.getHead();
-        for (int i = 0; i < n; i++) {
-            current->data = arr[i]->data;
-            current = current->next;
-        }
-        
+        relink(list, arr, n);
         delete[] arr;
     }
 
@@ -203,33 +211,70 @@ long long measureSortTime(void (*sortFunc)(LinkedList<T>&), LinkedList<T>& list)
     return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 }
 
+// Merge sort over [first, last) of a random-access range: raw pointers or
+// SegmentedArray iterators. Stable; orders by operator>.
+template<typename It>
+void mergeSortRange(It first, It last) {
+    typedef typename std::iterator_traits<It>::value_type T;
+    int n = static_cast<int>(last - first);
+    if (n < 2) return;
+    int n1 = (n + 1) / 2;
+    int n2 = n - n1;
+    mergeSortRange(first, first + n1);
+    mergeSortRange(first + n1, last);
+    // Merge
+    Array<T> leftHalf(n1), rightHalf(n2);
+    for (int i = 0; i < n1; ++i) leftHalf.push_back(std::move(first[i]));
+    for (int j = 0; j < n2; ++j) rightHalf.push_back(std::move(first[n1 + j]));
+    // Raw pointers keep the merge loop free of bounds checks
+    T* L = leftHalf.data();
+    T* R = rightHalf.data();
+    int i = 0, j = 0;
+    It k = first;
+    while (i < n1 && j < n2) {
+        if (!(L[i] > R[j])) *k++ = std::move(L[i++]);
+        else *k++ = std::move(R[j++]);
+    }
+    while (i < n1) *k++ = std::move(L[i++]);
+    while (j < n2) *k++ = std::move(R[j++]);
+}
+
 // Merge sort for Array<T>
 template<typename T>
 void mergeSortArray(Array<T>& arr, int left, int right) {
-    if (left < right) {
-        int mid = left + (right - left) / 2;
-        mergeSortArray(arr, left, mid);
-        mergeSortArray(arr, mid + 1, right);
-        // Merge
-        int n1 = mid - left + 1;
-        int n2 = right - mid;
-        Array<T> L(n1), R(n2);
-        for (int i = 0; i < n1; ++i) L.push_back(arr[left + i]);
-        for (int j = 0; j < n2; ++j) R.push_back(arr[mid + 1 + j]);
-        int i = 0, j = 0, k = left;
-        while (i < n1 && j < n2) {
-            if (!(L[i] > R[j])) arr[k++] = L[i++];
-            else arr[k++] = R[j++];
-        }
-        while (i < n1) arr[k++] = L[i++];
-        while (j < n2) arr[k++] = R[j++];
-    }
+    if (left < right) mergeSortRange(arr.data() + left, arr.data() + right + 1);
 }
 
-// Jump search for Array<T>
+// Merge sort for SegmentedArray<T>
 template<typename T>
-bool jumpSearchArray(const Array<T>& arr, const T& target) {
-    int n = arr.getSize();
+void mergeSortArray(SegmentedArray<T>& arr, int left, int right) {
+    if (left < right) mergeSortRange(arr.begin() + left, arr.begin() + right + 1);
+}
+
+// Sorts the array by keyOf(element) through (key, index) pairs: the merge
+// sort moves the small pairs, then one gather pass moves each element once.
+// Gives the order of a stable merge sort by key.
+template<typename T, typename KeyFn>
+void mergeSortArrayByKey(Array<T>& arr, KeyFn keyOf) {
+    auto pairs = makeKeyIndex(arr.data(), arr.getSize(), keyOf);
+    mergeSortRange(pairs.data(), pairs.data() + pairs.getSize());
+    Array<int> order = orderOf(pairs);
+    applyOrder(arr.data(), order);
+}
+
+// The array in order of keyOf(element), without moving any element. The
+// view reads through arr.data(), so arr must not grow while it is in use.
+template<typename T, typename KeyFn>
+SortedView<const T*> sortedViewByKey(const Array<T>& arr, KeyFn keyOf) {
+    auto pairs = makeKeyIndex(arr.data(), arr.getSize(), keyOf);
+    mergeSortRange(pairs.data(), pairs.data() + pairs.getSize());
+    return SortedView<const T*>(arr.data(), orderOf(pairs));
+}
+
+// Jump search over a sorted random-access range [first, last)
+template<typename It, typename T>
+bool jumpSearchRange(It arr, It last, const T& target) {
+    int n = static_cast<int>(last - arr);
     if (n == 0) return false;
     int step = sqrt(n);
     int prev = 0;
@@ -246,4 +291,16 @@ bool jumpSearchArray(const Array<T>& arr, const T& target) {
     return false;
 }
 
+// Jump search for Array<T>
+template<typename T>
+bool jumpSearchArray(const Array<T>& array, const T& target) {
+    return jumpSearchRange(array.begin(), array.end(), target);
+}
+
+// Jump search for SegmentedArray<T>
+template<typename T>
+bool jumpSearchArray(const SegmentedArray<T>& array, const T& target) {
+    return jumpSearchRange(array.begin(), array.end(), target);
+}
+
 #endif // ALGORITHMS_HPP 
\ No newline at end of file
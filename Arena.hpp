@@ -0,0 +1,116 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+// Bump allocator that owns the string bytes of a loaded dataset. Memory is
+// handed out from large blocks and is never freed piece by piece: the whole
+// arena is released at once, which makes tearing down millions of records
+// cost one free per block instead of one per field.
+// Not thread-safe; give each thread its own arena and absorb() them after.
+class Arena {
+private:
+    struct Block {
+        Block* next;
+        size_t capacity;
+        size_t used;
+
+        char* bytes() { return reinterpret_cast<char*>(this + 1); }
+    };
+
+    Block* head;          // Block currently being filled; older blocks follow
+    size_t blockSize;
+    size_t totalBytes;
+
+    Block* newBlock(size_t capacity) {
+        Block* block = static_cast<Block*>(::operator new(sizeof(Block) + capacity));
+        block->capacity = capacity;
+        block->used = 0;
+        return block;
+    }
+
+public:
+    static const size_t DEFAULT_BLOCK_SIZE = 1 << 20;
+
+    explicit Arena(size_t defaultBlockSize = DEFAULT_BLOCK_SIZE)
+        : head(nullptr), blockSize(defaultBlockSize), totalBytes(0) {}
+
+    ~Arena() {
+        release();
+    }
+
+    // Records point into the arena, so it cannot be copied
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Returns size bytes aligned to align (a power of two)
+    void* allocate(size_t size, size_t align = 1) {
+        if (head) {
+            size_t start = (head->used + align - 1) & ~(align - 1);
+            if (start + size <= head->capacity) {
+                head->used = start + size;
+                totalBytes += size;
+                return head->bytes() + start;
+            }
+        }
+
+        // Oversized requests get a block of their own behind the current one,
+        // so the space left in the current block is not wasted
+        size_t needed = size + align - 1;
+        Block* block = newBlock(needed > blockSize ? needed : blockSize);
+        if (needed > blockSize && head) {
+            block->next = head->next;
+            head->next = block;
+        } else {
+            block->next = head;
+            head = block;
+        }
+        size_t start = (reinterpret_cast<size_t>(block->bytes()) + align - 1) & ~(align - 1);
+        start -= reinterpret_cast<size_t>(block->bytes());
+        block->used = start + size;
+        totalBytes += size;
+        return block->bytes() + start;
+    }
+
+    // Copies len bytes and a terminating '\0'; the copy lives as long as the arena
+    char* copy(const char* str, size_t len) {
+        char* out = static_cast<char*>(allocate(len + 1));
+        if (len) memcpy(out, str, len);
+        out[len] = '\0';
+        return out;
+    }
+
+    // Takes over all blocks of other, leaving it empty. Used to collect the
+    // per-thread arenas of a parallel load into one.
+    void absorb(Arena& other) {
+        if (!other.head) return;
+        Block* last = other.head;
+        while (last->next) last = last->next;
+        last->next = head ? head->next : nullptr;
+        if (head) {
+            head->next = other.head;
+        } else {
+            head = other.head;
+        }
+        totalBytes += other.totalBytes;
+        other.head = nullptr;
+        other.totalBytes = 0;
+    }
+
+    // Frees every block; all pointers handed out become invalid
+    void release() {
+        while (head) {
+            Block* next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+        totalBytes = 0;
+    }
+
+    // Bytes handed out so far (excluding alignment and unused block space)
+    size_t bytesUsed() const { return totalBytes; }
+};
+
+#endif // ARENA_HPP
@@ -1,80 +1,234 @@
 #ifndef ARRAY_HPP
 #define ARRAY_HPP
 
+#include <cstddef>
 #include <stdexcept>
-#include <memory>
+#include <new>
+#include <utility>
 
+// Bounds checking for operator[] is a compile-time policy. It is on unless
+// NDEBUG is defined; build with -DARRAY_CHECKED=0 or 1 to force it.
+#ifndef ARRAY_CHECKED
+#ifdef NDEBUG
+#define ARRAY_CHECKED 0
+#else
+#define ARRAY_CHECKED 1
+#endif
+#endif
+
+// Throws on an index outside [0, size)
+struct CheckedAccess {
+    static void check(int index, int size) {
+        if (index < 0 || index >= size) {
+            throw std::out_of_range("Array index out of bounds");
+        }
+    }
+};
+
+// No check; for release builds of the sort and scan loops
+struct UncheckedAccess {
+    static void check(int, int) {}
+};
+
+#if ARRAY_CHECKED
+typedef CheckedAccess DefaultAccess;
+#else
+typedef UncheckedAccess DefaultAccess;
+#endif
+
+// Contiguous view of part of an array: raw pointer and length, unchecked
 template<typename T>
+struct ArraySpan {
+    T* ptr;
+    int length;
+
+    T& operator[](int index) const { return ptr[index]; }
+    T* begin() const { return ptr; }
+    T* end() const { return ptr + length; }
+    int size() const { return length; }
+};
+
+// Growable array on raw storage: capacity is allocated without constructing
+// anything, elements are constructed in place as they are added and moved
+// (not copied) when the storage grows. Reserving room for a known number of
+// rows therefore costs one allocation and no constructions.
+//
+// This is the one array template of the project; add/get/removeLast keep the
+// interface amalAns used with the former Structure.hpp array.
+template<typename T, typename Access = DefaultAccess>
 class Array {
 private:
-    std::unique_ptr<T[]> data;
+    // Storage comes from plain ::operator new, which (before C++17) only
+    // guarantees fundamental alignment
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Array does not support over-aligned types");
+
+    T* items;
     int size;
     int capacity;
 
-    void resize(int newCapacity) {
-        std::unique_ptr<T[]> newData(new T[newCapacity]);
+    static T* allocate(int n) {
+        if (n <= 0) return nullptr;
+        return static_cast<T*>(::operator new(sizeof(T) * static_cast<size_t>(n)));
+    }
+
+    static void deallocate(T* p) {
+        ::operator delete(p);
+    }
+
+    void destroyAll() {
+        for (int i = 0; i < size; i++) {
+            items[i].~T();
+        }
+    }
+
+    // Moves the elements into newData (capacity newCapacity) and frees the old block
+    void adopt(T* newData, int newCapacity) {
         for (int i = 0; i < size; i++) {
-            newData[i] = std::move(data[i]);
+            new (newData + i) T(std::move(items[i]));
+            items[i].~T();
         }
-        data = std::move(newData);
+        deallocate(items);
+        items = newData;
         capacity = newCapacity;
     }
 
+    void resize(int newCapacity) {
+        adopt(allocate(newCapacity), newCapacity);
+    }
+
 public:
     // Constructors and destructor
-    Array(int initialCapacity = 10) : data(new T[initialCapacity]), size(0), capacity(initialCapacity) {}
-    
+    Array(int initialCapacity = 10) : items(allocate(initialCapacity)), size(0),
+                                      capacity(initialCapacity > 0 ? initialCapacity : 0) {}
+
     ~Array() {
-        // Destructor is implicitly called when std::unique_ptr goes out of scope
+        destroyAll();
+        deallocate(items);
+    }
+
+    // Move constructor; other is left empty
+    Array(Array&& other) noexcept : items(other.items), size(other.size), capacity(other.capacity) {
+        other.items = nullptr;
+        other.size = 0;
+        other.capacity = 0;
     }
 
     // Copy constructor
-    Array(const Array& other) : data(new T[other.capacity]), size(other.size), capacity(other.capacity) {
-        for (int i = 0; i < size; i++) {
-            data[i] = other.data[i];
+    Array(const Array& other) : items(allocate(other.capacity)), size(0), capacity(other.capacity) {
+        for (; size < other.size; size++) {
+            new (items + size) T(other.items[size]);
         }
     }
 
     // Assignment operator
     Array& operator=(const Array& other) {
         if (this != &other) {
-            std::unique_ptr<T[]> newData(new T[other.capacity]);
-            for (int i = 0; i < other.size; i++) {
-                newData[i] = other.data[i];
-            }
-            data = std::move(newData);
+            Array copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    Array& operator=(Array&& other) noexcept {
+        if (this != &other) {
+            destroyAll();
+            deallocate(items);
+            items = other.items;
             size = other.size;
             capacity = other.capacity;
+            other.items = nullptr;
+            other.size = 0;
+            other.capacity = 0;
         }
         return *this;
     }
 
-    // Element access
+    // Element access, checked according to Access
     T& operator[](int index) {
-        if (index < 0 || index >= size) {
-            throw std::out_of_range("Array index out of bounds");
-        }
-        return data[index];
+        Access::check(index, size);
+        return items[index];
     }
 
     const T& operator[](int index) const {
-        if (index < 0 || index >= size) {
-            throw std::out_of_range("Array index out of bounds");
-        }
-        return data[index];
+        Access::check(index, size);
+        return items[index];
+    }
+
+    // Always checked
+    T& at(int index) {
+        CheckedAccess::check(index, size);
+        return items[index];
     }
 
+    const T& at(int index) const {
+        CheckedAccess::check(index, size);
+        return items[index];
+    }
+
+    T& get(int index) { return at(index); }
+
+    // Raw access for tight loops; valid until the array grows
+    T* data() { return items; }
+    const T* data() const { return items; }
+    T* begin() { return items; }
+    T* end() { return items + size; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + size; }
+
+    ArraySpan<T> span() { return ArraySpan<T>{items, size}; }
+    ArraySpan<const T> span() const { return ArraySpan<const T>{items, size}; }
+
     // Capacity
     bool empty() const { return size == 0; }
     int getSize() const { return size; }
+    int getCapacity() const { return capacity; }
+
+    // Grows the capacity to at least n elements, moving the existing ones
+    void reserve(int n) {
+        if (n > capacity) {
+            resize(n);
+        }
+    }
+
+    // Releases the unused capacity
+    void shrink_to_fit() {
+        if (size < capacity) {
+            resize(size);
+        }
+    }
 
     // Modifiers
     void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void add(const T& value) { emplace_back(value); }
+    void add(T&& value) { emplace_back(std::move(value)); }
+
+    void removeLast() {
+        if (size > 0) {
+            items[--size].~T();
+        }
+    }
+
+    // Constructs the element in place at the end. When the storage grows the
+    // new element is built first, so args may refer to an element of this array.
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
         if (size == capacity) {
-            resize(capacity * 2);
+            int newCapacity = capacity > 0 ? capacity * 2 : 1;
+            T* newData = allocate(newCapacity);
+            new (newData + size) T(std::forward<Args>(args)...);
+            adopt(newData, newCapacity);
+        } else {
+            new (items + size) T(std::forward<Args>(args)...);
         }
-        data[size++] = value;
+        return items[size++];
     }
 };
 
-#endif // ARRAY_HPP 
\ No newline at end of file
+#endif // ARRAY_HPP
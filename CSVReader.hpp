@@ -0,0 +1,361 @@
+#ifndef CSV_READER_HPP
+#define CSV_READER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include "SimdScan.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Read-only memory mapping of a whole file
+class MappedFile {
+private:
+    const char* data;
+    size_t length;
+    bool opened;
+#ifdef _WIN32
+    HANDLE fileHandle;
+    HANDLE mapHandle;
+#endif
+
+public:
+    MappedFile() : data(nullptr), length(0), opened(false) {
+#ifdef _WIN32
+        fileHandle = INVALID_HANDLE_VALUE;
+        mapHandle = nullptr;
+#endif
+    }
+
+    explicit MappedFile(const char* path) : MappedFile() {
+        open(path);
+    }
+
+    ~MappedFile() {
+        close();
+    }
+
+    // The mapping is owned, so copying is not allowed
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const char* path) {
+        close();
+#ifdef _WIN32
+        fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize)) {
+            close();
+            return false;
+        }
+        length = static_cast<size_t>(fileSize.QuadPart);
+        if (length > 0) {
+            mapHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapHandle == nullptr) {
+                close();
+                return false;
+            }
+            data = static_cast<const char*>(MapViewOfFile(mapHandle, FILE_MAP_READ, 0, 0, 0));
+            if (data == nullptr) {
+                close();
+                return false;
+            }
+        }
+#else
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        length = static_cast<size_t>(st.st_size);
+        if (length > 0) {
+            void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                length = 0;
+                return false;
+            }
+            madvise(mapped, length, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(mapped);
+        }
+        // The mapping stays valid after the descriptor is closed
+        ::close(fd);
+#endif
+        opened = true;
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (data) UnmapViewOfFile(data);
+        if (mapHandle) CloseHandle(mapHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+        mapHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (data) munmap(const_cast<char*>(data), length);
+#endif
+        data = nullptr;
+        length = 0;
+        opened = false;
+    }
+
+    bool isOpen() const { return opened; }
+    const char* begin() const { return data; }
+    const char* end() const { return data + length; }
+    size_t size() const { return length; }
+};
+
+// Non-owning (pointer, length) view of one field inside a mapped file.
+// For a quoted field the view covers the text between the quotes; escaped
+// is set when that text still contains doubled ("") quotes.
+struct FieldView {
+    const char* ptr;
+    size_t len;
+    bool escaped;
+
+    FieldView() : ptr(nullptr), len(0), escaped(false) {}
+    FieldView(const char* p, size_t n, bool esc = false) : ptr(p), len(n), escaped(esc) {}
+
+    bool empty() const { return len == 0; }
+    size_t size() const { return len; }
+    const char& operator[](size_t index) const { return ptr[index]; }
+
+    // Compare against a null-terminated literal without copying
+    bool equals(const char* str) const {
+        size_t n = strlen(str);
+        return n == len && memcmp(ptr, str, len) == 0;
+    }
+
+    // Position of the first occurrence of c, or -1
+    long find(char c) const {
+        const void* hit = len ? memchr(ptr, c, len) : nullptr;
+        return hit ? static_cast<const char*>(hit) - ptr : -1;
+    }
+
+    FieldView substr(size_t pos, size_t count) const {
+        if (pos > len) pos = len;
+        if (count > len - pos) count = len - pos;
+        return FieldView(ptr + pos, count, escaped);
+    }
+
+    // Copies the field with "" collapsed to "; out needs size() bytes.
+    // Returns the number of bytes written.
+    size_t copyTo(char* out) const {
+        if (!escaped) {
+            if (len) memcpy(out, ptr, len);
+            return len;
+        }
+        size_t n = 0;
+        for (size_t i = 0; i < len; i++) {
+            out[n++] = ptr[i];
+            if (ptr[i] == '"' && i + 1 < len && ptr[i + 1] == '"') i++;
+        }
+        return n;
+    }
+
+    std::string str() const {
+        std::string out(len, '\0');
+        out.resize(copyTo(&out[0]));
+        return out;
+    }
+};
+
+// Upper bound on fields per row; extra delimiters are folded into the last field
+const int CSV_MAX_FIELDS = 16;
+
+// One parsed row: field views into the mapping, no allocation
+struct CSVRow {
+    FieldView fields[CSV_MAX_FIELDS];
+    int count;
+
+    CSVRow() : count(0) {}
+
+    int getSize() const { return count; }
+    bool empty() const { return count == 0; }
+    const FieldView& operator[](int index) const { return fields[index]; }
+};
+
+// RFC 4180 parsing as a table-driven DFA. Each byte is mapped to a class,
+// and (state, class) gives the next state plus an action in one lookup.
+// A CR is an ordinary byte; a CR left at the end of an unquoted last
+// field is trimmed, which covers CRLF line ends.
+enum CSVCharClass { CSV_OTHER, CSV_DELIM, CSV_QUOTE, CSV_NEWLINE, CSV_CLASS_COUNT };
+enum CSVState { CSV_FIELD_START, CSV_UNQUOTED, CSV_QUOTED, CSV_QUOTE_SEEN, CSV_STATE_COUNT };
+enum CSVAction { CSV_NONE, CSV_OPEN_QUOTE, CSV_CLOSE_QUOTE, CSV_ESCAPE, CSV_END_FIELD, CSV_END_ROW };
+
+#define CSV_STEP(state, action) static_cast<unsigned char>((state) << 4 | (action))
+
+// Next state in the high nibble, action in the low nibble
+const unsigned char CSV_TRANSITIONS[CSV_STATE_COUNT][CSV_CLASS_COUNT] = {
+    // CSV_FIELD_START
+    { CSV_STEP(CSV_UNQUOTED, CSV_NONE), CSV_STEP(CSV_FIELD_START, CSV_END_FIELD),
+      CSV_STEP(CSV_QUOTED, CSV_OPEN_QUOTE), CSV_STEP(CSV_FIELD_START, CSV_END_ROW) },
+    // CSV_UNQUOTED: a stray quote inside an unquoted field is kept as text
+    { CSV_STEP(CSV_UNQUOTED, CSV_NONE), CSV_STEP(CSV_FIELD_START, CSV_END_FIELD),
+      CSV_STEP(CSV_UNQUOTED, CSV_NONE), CSV_STEP(CSV_FIELD_START, CSV_END_ROW) },
+    // CSV_QUOTED: delimiters and newlines are field text
+    { CSV_STEP(CSV_QUOTED, CSV_NONE), CSV_STEP(CSV_QUOTED, CSV_NONE),
+      CSV_STEP(CSV_QUOTE_SEEN, CSV_CLOSE_QUOTE), CSV_STEP(CSV_QUOTED, CSV_NONE) },
+    // CSV_QUOTE_SEEN: "" is an escaped quote, anything else after the closing
+    // quote up to the next delimiter is dropped
+    { CSV_STEP(CSV_QUOTE_SEEN, CSV_NONE), CSV_STEP(CSV_FIELD_START, CSV_END_FIELD),
+      CSV_STEP(CSV_QUOTED, CSV_ESCAPE), CSV_STEP(CSV_FIELD_START, CSV_END_ROW) }
+};
+
+#undef CSV_STEP
+
+// Row parser over a byte range [begin, end). Rows are returned as views
+// into the range, so they stay valid for as long as the bytes do.
+class CSVRange {
+protected:
+    const char* cursor;
+    const char* limit;
+    char delimiter;
+    int maxFields;
+    unsigned char charClass[256];
+
+public:
+    CSVRange(const char* begin, const char* end, char delim = ',')
+        : cursor(begin), limit(end), delimiter(delim), maxFields(CSV_MAX_FIELDS) {
+        memset(charClass, CSV_OTHER, sizeof(charClass));
+        charClass[static_cast<unsigned char>(delim)] = CSV_DELIM;
+        charClass[static_cast<unsigned char>('"')] = CSV_QUOTE;
+        charClass[static_cast<unsigned char>('\n')] = CSV_NEWLINE;
+    }
+
+    bool atEnd() const { return cursor >= limit; }
+    const char* position() const { return cursor; }
+
+    // Fields past the n-th are folded, unparsed, into the n-th field
+    // (the "last field takes the rest of the line" rule)
+    void setMaxFields(int n) {
+        maxFields = n < 1 ? 1 : (n > CSV_MAX_FIELDS ? CSV_MAX_FIELDS : n);
+    }
+
+    // Reads one physical line without CSV parsing; returns false at end of input
+    bool nextLine(FieldView& line) {
+        if (atEnd()) return false;
+        const char* nl = static_cast<const char*>(memchr(cursor, '\n', static_cast<size_t>(limit - cursor)));
+        const char* lineEnd = nl ? nl : limit;
+        line = FieldView(cursor, static_cast<size_t>(lineEnd - cursor));
+        if (lineEnd > cursor && lineEnd[-1] == '\r') line.len--;
+        cursor = nl ? nl + 1 : limit;
+        return true;
+    }
+
+    // Skips one line (e.g. the header); returns false at end of input
+    bool skipLine() {
+        FieldView line;
+        return nextLine(line);
+    }
+
+    // Reads the next non-blank row; returns false at end of input
+    bool nextRow(CSVRow& row) {
+        while (!atEnd()) {
+            row.count = 0;
+            const char* p = cursor;
+            const char* fieldStart = p;    // First byte of field text
+            const char* rawStart = p;      // First byte of the field, quote included
+            const char* closeQuote = nullptr;  // Closing quote of the current field, once seen
+            const char* foldStart = nullptr;
+            bool quoted = false;
+            bool escaped = false;
+            bool rowEnded = false;
+            int state = CSV_FIELD_START;
+
+            while (p < limit) {
+                // Runs of bytes that cannot change the state are skipped 16-32 at a time
+                if (state == CSV_UNQUOTED) {
+                    p = scanDelims(p, limit, delimiter, '\n', '\n');
+                    if (p == limit) break;
+                } else if (state == CSV_QUOTED) {
+                    p = scanDelims(p, limit, '"', '"', '"');
+                    if (p == limit) break;
+                }
+
+                unsigned char step = CSV_TRANSITIONS[state][charClass[static_cast<unsigned char>(*p)]];
+                state = step >> 4;
+                switch (step & 0xF) {
+                case CSV_OPEN_QUOTE:
+                    quoted = true;
+                    fieldStart = p + 1;
+                    closeQuote = nullptr;
+                    break;
+                case CSV_CLOSE_QUOTE:
+                    closeQuote = p;
+                    break;
+                case CSV_ESCAPE:
+                    escaped = true;
+                    closeQuote = nullptr;
+                    break;
+                case CSV_END_FIELD:
+                    if (foldStart == nullptr) {
+                        if (row.count < maxFields - 1) {
+                            const char* end = closeQuote ? closeQuote : p;
+                            row.fields[row.count++] = FieldView(fieldStart, static_cast<size_t>(end - fieldStart), escaped);
+                        } else {
+                            foldStart = rawStart;
+                        }
+                    }
+                    fieldStart = rawStart = p + 1;
+                    closeQuote = nullptr;
+                    quoted = escaped = false;
+                    break;
+                case CSV_END_ROW:
+                    rowEnded = true;
+                    break;
+                default:
+                    break;
+                }
+                if (rowEnded) break;
+                p++;
+            }
+
+            // p is at the newline or at the end of the input
+            const char* fieldEnd = p;
+            cursor = p < limit ? p + 1 : limit;
+            if (foldStart) {
+                fieldStart = foldStart;
+                quoted = escaped = false;
+            } else if (closeQuote) {
+                fieldEnd = closeQuote;
+            }
+            if (!quoted && fieldEnd > fieldStart && fieldEnd[-1] == '\r') fieldEnd--;
+            if (row.count == 0 && !quoted && fieldEnd == fieldStart) continue; // Blank line
+            row.fields[row.count++] = FieldView(fieldStart, static_cast<size_t>(fieldEnd - fieldStart), escaped);
+            return true;
+        }
+        return false;
+    }
+};
+
+// Sequential CSV reader over a memory-mapped file
+class CSVReader : public CSVRange {
+private:
+    MappedFile file;
+
+public:
+    CSVReader(const char* path, char delim = ',') : CSVRange(nullptr, nullptr, delim) {
+        if (file.open(path)) {
+            cursor = file.begin();
+            limit = file.end();
+        }
+    }
+
+    bool isOpen() const { return file.isOpen(); }
+    size_t fileSize() const { return file.size(); }
+};
+
+#endif // CSV_READER_HPP
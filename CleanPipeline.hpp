@@ -0,0 +1,220 @@
+#ifndef CLEAN_PIPELINE_HPP
+#define CLEAN_PIPELINE_HPP
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "CSVReader.hpp"
+#include "CleanUtils.h"
+#include "NumberParse.hpp"
+
+// In-memory cleaning stage shared by the cleaners and the analysis programs.
+// Raw rows are validated and each valid record is handed straight to a sink,
+// so writing the *Clean.csv files is only an optional side output.
+
+// Validated transaction fields, exactly as they are written to the clean CSV,
+// plus the price in cents and the date as a YYYYMMDD key
+struct CleanTransaction {
+    std::string customerID, product, category, priceStr, date, paymentMethod;
+    int64_t priceCents;
+    uint32_t dateKey;
+
+    CleanTransaction() : priceCents(0), dateKey(0) {}
+};
+
+// Validated review fields, exactly as they are written to the clean CSV
+struct CleanReview {
+    std::string productID, customerID, ratingStr, reviewText;
+    int rating;
+
+    CleanReview() : rating(0) {}
+};
+
+// Copies up to count parsed fields into the given strings; missing fields are left empty
+inline void assignFields(const CSVRow &row, std::string *fields[], int count) {
+    for (int i = 0; i < count; i++) {
+        if (i < row.getSize()) {
+            if (row[i].escaped) *fields[i] = row[i].str();
+            else fields[i]->assign(row[i].ptr, row[i].len);
+        } else {
+            fields[i]->clear();
+        }
+    }
+}
+
+// Validates one raw transactions.csv row. Problems are reported to log
+// (when given) in the same format the cleaner has always used.
+inline bool cleanTransactionRow(const CSVRow &row, int lineNumber, CleanTransaction &t, std::ostream *log) {
+    std::string *fields[] = {&t.customerID, &t.product, &t.category, &t.priceStr, &t.date, &t.paymentMethod};
+    assignFields(row, fields, 6);
+
+    bool isValid = true;
+
+    if (t.customerID.empty() || t.product.empty() || t.category.empty() ||
+        t.priceStr.empty() || t.date.empty() || t.paymentMethod.empty()) {
+        if (log) *log << "Line " << lineNumber << ": Missing required field(s)\n";
+        isValid = false;
+    }
+
+    if (parsePriceCents(t.priceStr.data(), t.priceStr.size(), t.priceCents) != NUM_OK) {
+        if (log) *log << "Line " << lineNumber << ": Invalid price format\n";
+        isValid = false;
+    } else {
+        if (t.priceCents <= 0) {
+            if (log) *log << "Line " << lineNumber << ": Price must be positive\n";
+            isValid = false;
+        }
+    }
+
+    if (!isValidDate(t.date, t.dateKey)) {
+        if (log) *log << "Line " << lineNumber << ": Invalid date format (use MM/DD/YYYY)\n";
+        isValid = false;
+    }
+
+    if (!isValidCategory(t.category)) {
+        if (log) *log << "Line " << lineNumber << ": Invalid category\n";
+        isValid = false;
+    }
+
+    if (!isValidPaymentMethod(t.paymentMethod)) {
+        if (log) *log << "Line " << lineNumber << ": Invalid payment method\n";
+        isValid = false;
+    }
+
+    return isValid;
+}
+
+// Validates one raw reviews.csv row; the review text is lowercased and cleaned
+inline bool cleanReviewRow(const CSVRow &row, int lineNumber, CleanReview &r, std::ostream *log) {
+    std::string *fields[] = {&r.productID, &r.customerID, &r.ratingStr, &r.reviewText};
+    assignFields(row, fields, 4);
+    r.rating = 0;
+
+    bool isValid = true;
+
+    if (r.productID.empty() || r.customerID.empty() || r.ratingStr.empty()) {
+        if (log) *log << "Line " << lineNumber << ": Missing required field(s)\n";
+        isValid = false;
+    }
+
+    if (r.ratingStr == "Invalid Rating") {
+        if (log) *log << "Line " << lineNumber << ": Invalid Rating found\n";
+        isValid = false;
+    }
+
+    uint8_t rating;
+    NumberStatus status = parseRating(r.ratingStr.data(), r.ratingStr.size(), rating);
+    if (status == NUM_EMPTY || status == NUM_INVALID) {
+        if (log) *log << "Line " << lineNumber << ": Rating must be a number\n";
+        isValid = false;
+    } else {
+        r.rating = rating;
+        if (status == NUM_OVERFLOW || r.rating < 1 || r.rating > 5) {
+            if (log) *log << "Line " << lineNumber << ": Rating must be between 1 and 5\n";
+            isValid = false;
+        }
+    }
+
+    cleanReviewText(r.reviewText);
+    if (r.reviewText.empty()) {
+        if (log) *log << "Line " << lineNumber << ": Empty review text after cleaning\n";
+        isValid = false;
+    }
+
+    return isValid;
+}
+
+// Number of newlines in [from, to)
+inline int countNewlines(const char *from, const char *to) {
+    int count = 0;
+    while (from < to) {
+        const char *nl = static_cast<const char *>(memchr(from, '\n', to - from));
+        if (!nl) break;
+        count++;
+        from = nl + 1;
+    }
+    return count;
+}
+
+// Tracks the physical line each record starts on. Quoted fields may contain
+// newlines and blank lines are skipped, so this is not the record count.
+class LineCounter {
+private:
+    int nextLine;           // Line at the current input position
+    const char *counted;    // Input counted up to here
+
+public:
+    LineCounter(const CSVRange &input, int line) : nextLine(line), counted(input.position()) {}
+
+    // Line the row just read starts on; advances past the row
+    int rowRead(const CSVRow &row, const CSVRange &input) {
+        const char *start = row.getSize() > 0 ? row[0].ptr : input.position();
+        int line = nextLine + countNewlines(counted, start);
+        nextLine = line + countNewlines(start, input.position());
+        counted = input.position();
+        return line;
+    }
+};
+
+// Cleans raw transactions rows and calls sink(const CleanTransaction&)
+// for every valid row. cleanOut, when given, receives the clean CSV.
+// Returns the number of valid rows.
+template<typename Sink>
+int runTransactionPipeline(CSVRange &input, Sink sink, std::ostream *cleanOut, std::ostream *log) {
+    input.skipLine(); // Skip header
+    input.setMaxFields(6);
+    if (cleanOut) *cleanOut << "Customer|Product,Category,Price,Date,Payment Method" << std::endl;
+
+    CSVRow row;
+    CleanTransaction t;
+    LineCounter lines(input, 2); // Header is line 1
+    int valid = 0;
+    while (input.nextRow(row)) {
+        int lineNumber = lines.rowRead(row, input);
+        if (!cleanTransactionRow(row, lineNumber, t, log)) continue;
+
+        sink(t);
+        valid++;
+
+        if (cleanOut) {
+            *cleanOut << t.customerID << "|" << t.product << ","
+                      << t.category << "," << t.priceStr << ","
+                      << t.date << "," << t.paymentMethod << std::endl;
+        }
+    }
+    return valid;
+}
+
+// Cleans raw reviews rows and calls sink(const CleanReview&) for every valid row.
+// Same contract as runTransactionPipeline. Quoted review text may contain
+// commas, escaped quotes and newlines.
+template<typename Sink>
+int runReviewPipeline(CSVRange &input, Sink sink, std::ostream *cleanOut, std::ostream *log) {
+    FieldView header;
+    input.nextLine(header); // Header is copied through unchanged
+    input.setMaxFields(4);
+    if (cleanOut) {
+        cleanOut->write(header.ptr, header.len);
+        *cleanOut << std::endl;
+    }
+
+    CSVRow row;
+    CleanReview r;
+    LineCounter lines(input, 2); // Header is line 1
+    int valid = 0;
+    while (input.nextRow(row)) {
+        int lineNumber = lines.rowRead(row, input);
+        if (!cleanReviewRow(row, lineNumber, r, log)) continue;
+
+        sink(r);
+        valid++;
+
+        if (cleanOut) {
+            *cleanOut << r.productID << "," << r.customerID << ","
+                      << r.ratingStr << "," << r.reviewText << std::endl;
+        }
+    }
+    return valid;
+}
+
+#endif // CLEAN_PIPELINE_HPP
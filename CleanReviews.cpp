@@ -3,7 +3,8 @@
 #include <sstream>
 #include <cstring>
 #include <cctype>
-#include "CleanUtils.h"
+#include "CleanPipeline.hpp"
+#include "ColumnarCache.hpp"
 
 using namespace std;
 
@@ -57,19 +58,9 @@ public:
 };
 
 
-string cleanText(string text) {
-    string result;
-    for(char c : text) {
-        if(isalnum(c) || isspace(c)) {
-            result += c;
-        }
-    }
-    return result;
-}
-
-int cleanReviews(Review *&reviews, int &size) {
-    ifstream inFile("data/reviews.csv");
-    if (!inFile.is_open()) {
+int cleanReviews(Review *&reviews, int &size, bool writeCache) {
+    CSVReader inFile("data/reviews.csv");
+    if (!inFile.isOpen()) {
         cout << "Error: Cannot open data/reviews.csv\n";
         return 0;
     }
@@ -77,86 +68,49 @@ int cleanReviews(Review *&reviews, int &size) {
     ofstream outFile("data/reviewsClean.csv");
     if (!outFile.is_open()) {
         cout << "Error: Cannot create data/reviewsClean.csv\n";
-        inFile.close();
         return 0;
     }
 
-    string line;
-    getline(inFile, line);  // Read header
-    outFile << line << endl;  // Write header to new file
-
     ReviewList validReviews;
-    int lineNumber = 1;
-
-    while (getline(inFile, line)) {
-        lineNumber++;
-        stringstream ss(line);
-        string productID, customerID, ratingStr, reviewText;
-        
-        getline(ss, productID, ',');
-        getline(ss, customerID, ',');
-        getline(ss, ratingStr, ',');
-        getline(ss, reviewText);
-
-        bool isValid = true;
-
-        if (productID.empty() || customerID.empty() || ratingStr.empty()) {
-            cout << "Line " << lineNumber << ": Missing required field(s)\n";
-            isValid = false;
-        }
-
-        if (ratingStr == "Invalid Rating") {
-            cout << "Line " << lineNumber << ": Invalid Rating found\n";
-            isValid = false;
-        }
-
-        if (!isValidInteger(ratingStr)) {
-            cout << "Line " << lineNumber << ": Rating must be a number\n";
-            isValid = false;
-        } else {
-            int rating = stoi(ratingStr);
-            if (rating < 1 || rating > 5) {
-                cout << "Line " << lineNumber << ": Rating must be between 1 and 5\n";
-                isValid = false;
-            }
-        }
-
-        reviewText = cleanText(toLowerCase(reviewText));
-        if (reviewText.empty()) {
-            cout << "Line " << lineNumber << ": Empty review text after cleaning\n";
-            isValid = false;
-        }
-
-        if (!isValid) continue;
+    ReviewCacheWriter cache;
 
+    runReviewPipeline(inFile, [&](const CleanReview &c) {
         Review r;
-        r.productID = productID;
-        r.customerID = customerID;
-        r.rating = stoi(ratingStr);
-        r.reviewText = reviewText;
+        r.productID = c.productID;
+        r.customerID = c.customerID;
+        r.rating = c.rating;
+        r.reviewText = c.reviewText;
         validReviews.add(r);
+        if (writeCache) cache.add(c);
+    }, &outFile, &cout);
 
-        outFile << productID << "," << customerID << "," 
-               << ratingStr << "," << reviewText << endl;
-    }
-
-    inFile.close();
     outFile.close();
 
     cout << "Cleaned reviews saved as reviewsClean.csv\n";
 
+    if (writeCache) {
+        if (cache.write("data/reviewsClean.bin", "data/reviewsClean.csv")) {
+            cout << "Binary cache saved to data/reviewsClean.bin\n";
+        } else {
+            cout << "Error: Cannot create data/reviewsClean.bin\n";
+        }
+    }
+
     size = validReviews.getCount();
     validReviews.toArray(reviews);
 
     return size;
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+    // --cache also writes a binary columnar copy of the clean data
+    bool writeCache = argc > 1 && strcmp(argv[1], "--cache") == 0;
+
     Review *reviews = nullptr;
     int reviewSize = 0;
 
     cout << "Cleaning reviews...\n";
-    cleanReviews(reviews, reviewSize);
+    cleanReviews(reviews, reviewSize, writeCache);
     cout << "Loaded " << reviewSize << " valid reviews.\n";
 
     delete[] reviews;
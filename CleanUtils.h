@@ -3,9 +3,11 @@
 
 #include <string>
 #include <cctype>
+#include "NumberParse.hpp"
+#include "SimdText.hpp"
 
 inline std::string toLowerCase(std::string str) {
-    for (char &c : str) c = std::tolower(c);
+    asciiLower(&str[0], str.size());
     return str;
 }
 
@@ -17,4 +19,51 @@ inline bool isValidInteger(const std::string &str) {
     return true;
 }
 
+// Validates a DD/MM/YYYY date in 2000-2024 and returns its YYYYMMDD key
+inline bool isValidDate(const std::string &date, uint32_t &key) {
+    if(parseDateKey(date.data(), date.size(), key) != NUM_OK) return false;
+    uint32_t year = key / 10000;
+    return year >= 2000 && year <= 2024;
+}
+
+inline bool isValidDate(const std::string &date) {
+    uint32_t key;
+    return isValidDate(date, key);
+}
+
+inline bool isValidCategory(const std::string &category) {
+    static const std::string validCategories[] = {
+        "Electronics", "Fashion", "Books", "Automotive", "Beauty",
+        "Sports", "Toys", "Furniture", "Groceries", "Home Appliances"
+    };
+    std::string cat = toLowerCase(category);
+    for(const std::string &valid : validCategories) {
+        if(toLowerCase(valid) == cat) return true;
+    }
+    return false;
+}
+
+inline bool isValidPaymentMethod(const std::string &method) {
+    static const std::string validMethods[] = {
+        "Credit Card", "Debit Card", "Cash", "PayPal",
+        "Bank Transfer", "Cash on Delivery"
+    };
+    std::string m = toLowerCase(method);
+    for(const std::string &valid : validMethods) {
+        if(toLowerCase(valid) == m) return true;
+    }
+    return false;
+}
+
+// Lowercases text and keeps only letters, digits and whitespace, in place.
+// Tabs and line breaks (a quoted review may span lines) become spaces, so
+// the text stays on one line when written to the clean CSV unquoted.
+inline void cleanReviewText(std::string &text) {
+    asciiLower(&text[0], text.size());
+    text.resize(keepAlnumSpace(&text[0], text.size()));
+    for (char &c : text) {
+        if (c >= '\t' && c <= '\r') c = ' ';
+    }
+}
+
 #endif // CLEANUTILS_H
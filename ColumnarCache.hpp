@@ -0,0 +1,397 @@
+#ifndef COLUMNAR_CACHE_HPP
+#define COLUMNAR_CACHE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include "Array.hpp"
+#include "CSVReader.hpp"
+#include "CleanPipeline.hpp"
+
+// Binary columnar cache written next to the clean CSVs by the cleaners.
+// The analysis programs map it and read records straight out of the columns.
+// Integers are stored in native byte order, so the cache is machine-local;
+// the header ties it to the exact clean CSV it was built from.
+
+const char CACHE_MAGIC[4] = {'D', 'S', 'C', 'C'};
+const uint32_t CACHE_VERSION = 1;
+const int CACHE_MAX_COLUMNS = 8;
+
+enum CacheKind {
+    CACHE_TRANSACTIONS = 1,
+    CACHE_REVIEWS = 2
+};
+
+// Column indices for each kind of cache
+enum TransactionColumn {
+    TX_DATE, TX_PRICE, TX_CATEGORY_CODE, TX_CATEGORY_DICT,
+    TX_PAYMENT_CODE, TX_PAYMENT_DICT, TX_CUSTOMER, TX_PRODUCT, TX_COLUMN_COUNT
+};
+
+enum ReviewColumn {
+    RV_PRODUCT, RV_CUSTOMER, RV_RATING, RV_TEXT, RV_COLUMN_COUNT
+};
+
+struct CacheColumn {
+    uint64_t offset;
+    uint64_t bytes;
+};
+
+struct CacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t kind;
+    uint32_t rowCount;
+    uint64_t sourceSize;   // Size of the clean CSV the cache was built from
+    int64_t sourceMtime;   // Modification time of that CSV
+    uint32_t columnCount;
+    uint32_t reserved;
+    CacheColumn columns[CACHE_MAX_COLUMNS];
+};
+
+// Size and modification time of a file; false if it does not exist
+inline bool statFile(const char* path, uint64_t& size, int64_t& mtime) {
+    struct stat st;
+    if (stat(path, &st) != 0) return false;
+    size = static_cast<uint64_t>(st.st_size);
+    mtime = static_cast<int64_t>(st.st_mtime);
+    return true;
+}
+
+// ---------------------------------------------------------------- Writing --
+
+// Appends the raw bytes of a value to a column buffer
+template<typename T>
+inline void appendRaw(std::string& column, const T& value) {
+    column.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// String table: u32 count, u32 offsets[count + 1], then the bytes
+class StringTableBuilder {
+private:
+    std::string offsets;
+    std::string bytes;
+    uint32_t count;
+    bool overflowed;
+
+public:
+    StringTableBuilder() : count(0), overflowed(false) {
+        appendRaw(offsets, static_cast<uint32_t>(0));
+    }
+
+    void add(const std::string& value) {
+        if (overflowed) return; // The table will not be written; stop growing it
+        if (value.size() > UINT32_MAX - bytes.size()) {
+            overflowed = true;
+            return;
+        }
+        bytes += value;
+        appendRaw(offsets, static_cast<uint32_t>(bytes.size()));
+        count++;
+    }
+
+    uint32_t getCount() const { return count; }
+
+    // False once the bytes outgrow the u32 offsets; such a table must not be written
+    bool fits() const { return !overflowed; }
+
+    std::string build() const {
+        std::string out;
+        appendRaw(out, count);
+        out += offsets;
+        out += bytes;
+        return out;
+    }
+};
+
+// Maps a small set of distinct values to one-byte codes
+class DictionaryBuilder {
+private:
+    std::string values[256];
+    StringTableBuilder table;
+
+public:
+    // Returns false once more than 256 distinct values have been seen
+    bool encode(const std::string& value, uint8_t& code) {
+        uint32_t n = table.getCount();
+        for (uint32_t i = 0; i < n; i++) {
+            if (values[i] == value) {
+                code = static_cast<uint8_t>(i);
+                return true;
+            }
+        }
+        if (n == 256) return false;
+        values[n] = value;
+        table.add(value);
+        code = static_cast<uint8_t>(n);
+        return true;
+    }
+
+    std::string build() const { return table.build(); }
+};
+
+// Writes the header and 8-byte aligned columns; stamps the cache with the
+// size and mtime of sourcePath so stale caches can be detected
+inline bool writeCacheFile(const char* path, const char* sourcePath, uint32_t kind,
+                           uint32_t rowCount, const std::string* columns, int columnCount) {
+    CacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.kind = kind;
+    header.rowCount = rowCount;
+    header.columnCount = static_cast<uint32_t>(columnCount);
+    if (!statFile(sourcePath, header.sourceSize, header.sourceMtime)) return false;
+
+    uint64_t offset = sizeof(CacheHeader);
+    for (int i = 0; i < columnCount; i++) {
+        offset = (offset + 7) & ~static_cast<uint64_t>(7);
+        header.columns[i].offset = offset;
+        header.columns[i].bytes = columns[i].size();
+        offset += columns[i].size();
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out.is_open()) return false;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    uint64_t written = sizeof(CacheHeader);
+    for (int i = 0; i < columnCount; i++) {
+        static const char padding[8] = {0};
+        out.write(padding, static_cast<std::streamsize>(header.columns[i].offset - written));
+        out.write(columns[i].data(), static_cast<std::streamsize>(columns[i].size()));
+        written = header.columns[i].offset + columns[i].size();
+    }
+    return out.good();
+}
+
+// Collects validated transactions column by column
+class TransactionCacheWriter {
+private:
+    std::string dates, prices, categoryCodes, paymentCodes;
+    DictionaryBuilder categories, payments;
+    StringTableBuilder customers, products;
+    uint32_t rows;
+    bool ok;
+
+public:
+    TransactionCacheWriter() : rows(0), ok(true) {}
+
+    void add(const CleanTransaction& t) {
+        uint8_t categoryCode = 0, paymentCode = 0;
+        ok = ok && categories.encode(t.category, categoryCode) && payments.encode(t.paymentMethod, paymentCode);
+        appendRaw(dates, t.dateKey);
+        appendRaw(prices, t.priceCents);
+        appendRaw(categoryCodes, categoryCode);
+        appendRaw(paymentCodes, paymentCode);
+        customers.add(t.customerID);
+        products.add(t.product);
+        rows++;
+    }
+
+    bool write(const char* path, const char* sourcePath) const {
+        if (!ok || !customers.fits() || !products.fits()) return false;
+        std::string columns[TX_COLUMN_COUNT];
+        columns[TX_DATE] = dates;
+        columns[TX_PRICE] = prices;
+        columns[TX_CATEGORY_CODE] = categoryCodes;
+        columns[TX_CATEGORY_DICT] = categories.build();
+        columns[TX_PAYMENT_CODE] = paymentCodes;
+        columns[TX_PAYMENT_DICT] = payments.build();
+        columns[TX_CUSTOMER] = customers.build();
+        columns[TX_PRODUCT] = products.build();
+        return writeCacheFile(path, sourcePath, CACHE_TRANSACTIONS, rows, columns, TX_COLUMN_COUNT);
+    }
+};
+
+// Collects validated reviews column by column
+class ReviewCacheWriter {
+private:
+    std::string ratings;
+    StringTableBuilder productIDs, customerIDs, texts;
+    uint32_t rows;
+
+public:
+    ReviewCacheWriter() : rows(0) {}
+
+    void add(const CleanReview& r) {
+        productIDs.add(r.productID);
+        customerIDs.add(r.customerID);
+        appendRaw(ratings, static_cast<uint8_t>(r.rating));
+        texts.add(r.reviewText);
+        rows++;
+    }
+
+    bool write(const char* path, const char* sourcePath) const {
+        if (!productIDs.fits() || !customerIDs.fits() || !texts.fits()) return false;
+        std::string columns[RV_COLUMN_COUNT];
+        columns[RV_PRODUCT] = productIDs.build();
+        columns[RV_CUSTOMER] = customerIDs.build();
+        columns[RV_RATING] = ratings;
+        columns[RV_TEXT] = texts.build();
+        return writeCacheFile(path, sourcePath, CACHE_REVIEWS, rows, columns, RV_COLUMN_COUNT);
+    }
+};
+
+// ---------------------------------------------------------------- Reading --
+
+// View of a string table inside the mapping
+class StringTableView {
+private:
+    const uint32_t* offsets;
+    const char* bytes;
+    uint32_t count;
+
+public:
+    StringTableView() : offsets(nullptr), bytes(nullptr), count(0) {}
+
+    // Checks that the table fits inside its column and that the offsets
+    // never decrease, so every get() stays inside the column
+    bool attach(const char* column, uint64_t columnBytes) {
+        if (columnBytes < sizeof(uint32_t)) return false;
+        memcpy(&count, column, sizeof(uint32_t));
+        uint64_t headerBytes = sizeof(uint32_t) * (static_cast<uint64_t>(count) + 2);
+        if (columnBytes < headerBytes) return false;
+        offsets = reinterpret_cast<const uint32_t*>(column + sizeof(uint32_t));
+        bytes = column + headerBytes;
+        for (uint32_t i = 0; i < count; i++) {
+            if (offsets[i] > offsets[i + 1]) return false;
+        }
+        return offsets[count] <= columnBytes - headerBytes;
+    }
+
+    uint32_t getCount() const { return count; }
+
+    FieldView get(uint32_t index) const {
+        return FieldView(bytes + offsets[index], offsets[index + 1] - offsets[index]);
+    }
+};
+
+// Maps a cache file and validates its header against the clean CSV.
+// Any mismatch (version, kind, source size or mtime) makes open() fail
+// so the caller falls back to parsing the CSV.
+class CacheFile {
+protected:
+    MappedFile file;
+    const CacheHeader* header;
+
+    bool openCache(const char* cachePath, const char* sourcePath, uint32_t kind, uint32_t columnCount) {
+        header = nullptr;
+        uint64_t sourceSize;
+        int64_t sourceMtime;
+        if (!statFile(sourcePath, sourceSize, sourceMtime)) return false;
+        if (!file.open(cachePath) || file.size() < sizeof(CacheHeader)) return false;
+
+        const CacheHeader* h = reinterpret_cast<const CacheHeader*>(file.begin());
+        if (memcmp(h->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || h->version != CACHE_VERSION ||
+            h->kind != kind || h->columnCount != columnCount) return false;
+        if (h->sourceSize != sourceSize || h->sourceMtime != sourceMtime) return false;
+        for (uint32_t i = 0; i < columnCount; i++) {
+            if (h->columns[i].offset > file.size() || h->columns[i].bytes > file.size() - h->columns[i].offset) {
+                return false;
+            }
+        }
+        header = h;
+        return true;
+    }
+
+    // Row index into the columns, checked like an Array index
+    uint32_t row(int i) const {
+        DefaultAccess::check(i, getSize());
+        return static_cast<uint32_t>(i);
+    }
+
+    const char* column(int index) const { return file.begin() + header->columns[index].offset; }
+    uint64_t columnBytes(int index) const { return header->columns[index].bytes; }
+
+    // Fixed-width column holding one T per row
+    bool fixedColumnFits(int index, size_t width) const {
+        return columnBytes(index) >= static_cast<uint64_t>(header->rowCount) * width;
+    }
+
+    // Every code of a one-byte code column indexes the dictionary
+    bool codesBelow(int index, uint32_t dictionarySize) const {
+        const uint8_t* codes = reinterpret_cast<const uint8_t*>(column(index));
+        for (uint32_t i = 0; i < header->rowCount; i++) {
+            if (codes[i] >= dictionarySize) return false;
+        }
+        return true;
+    }
+
+public:
+    CacheFile() : header(nullptr) {}
+
+    bool isOpen() const { return header != nullptr; }
+    int getSize() const { return header ? static_cast<int>(header->rowCount) : 0; }
+};
+
+class TransactionCache : public CacheFile {
+private:
+    const uint32_t* dates;
+    const int64_t* prices;
+    const uint8_t* categoryCodes;
+    const uint8_t* paymentCodes;
+    StringTableView categories, payments, customers, products;
+
+public:
+    bool open(const char* cachePath, const char* sourcePath) {
+        if (!openCache(cachePath, sourcePath, CACHE_TRANSACTIONS, TX_COLUMN_COUNT)) return false;
+        uint32_t n = header->rowCount;
+        bool valid = fixedColumnFits(TX_DATE, sizeof(uint32_t)) && fixedColumnFits(TX_PRICE, sizeof(int64_t)) &&
+                     fixedColumnFits(TX_CATEGORY_CODE, 1) && fixedColumnFits(TX_PAYMENT_CODE, 1) &&
+                     categories.attach(column(TX_CATEGORY_DICT), columnBytes(TX_CATEGORY_DICT)) &&
+                     payments.attach(column(TX_PAYMENT_DICT), columnBytes(TX_PAYMENT_DICT)) &&
+                     customers.attach(column(TX_CUSTOMER), columnBytes(TX_CUSTOMER)) && customers.getCount() == n &&
+                     products.attach(column(TX_PRODUCT), columnBytes(TX_PRODUCT)) && products.getCount() == n &&
+                     codesBelow(TX_CATEGORY_CODE, categories.getCount()) && codesBelow(TX_PAYMENT_CODE, payments.getCount());
+        if (!valid) {
+            header = nullptr;
+            return false;
+        }
+        dates = reinterpret_cast<const uint32_t*>(column(TX_DATE));
+        prices = reinterpret_cast<const int64_t*>(column(TX_PRICE));
+        categoryCodes = reinterpret_cast<const uint8_t*>(column(TX_CATEGORY_CODE));
+        paymentCodes = reinterpret_cast<const uint8_t*>(column(TX_PAYMENT_CODE));
+        return true;
+    }
+
+    // Codes were checked against the dictionaries by open()
+    uint32_t dateKey(int i) const { return dates[row(i)]; }
+    int64_t priceCents(int i) const { return prices[row(i)]; }
+    uint8_t categoryCode(int i) const { return categoryCodes[row(i)]; }
+    uint8_t paymentCode(int i) const { return paymentCodes[row(i)]; }
+    FieldView category(int i) const { return categories.get(static_cast<uint32_t>(categoryCodes[row(i)])); }
+    FieldView paymentMethod(int i) const { return payments.get(static_cast<uint32_t>(paymentCodes[row(i)])); }
+    FieldView customerID(int i) const { return customers.get(row(i)); }
+    FieldView product(int i) const { return products.get(row(i)); }
+};
+
+class ReviewCache : public CacheFile {
+private:
+    const uint8_t* ratings;
+    StringTableView productIDs, customerIDs, texts;
+
+public:
+    bool open(const char* cachePath, const char* sourcePath) {
+        if (!openCache(cachePath, sourcePath, CACHE_REVIEWS, RV_COLUMN_COUNT)) return false;
+        uint32_t n = header->rowCount;
+        bool valid = fixedColumnFits(RV_RATING, 1) &&
+                     productIDs.attach(column(RV_PRODUCT), columnBytes(RV_PRODUCT)) && productIDs.getCount() == n &&
+                     customerIDs.attach(column(RV_CUSTOMER), columnBytes(RV_CUSTOMER)) && customerIDs.getCount() == n &&
+                     texts.attach(column(RV_TEXT), columnBytes(RV_TEXT)) && texts.getCount() == n;
+        if (!valid) {
+            header = nullptr;
+            return false;
+        }
+        ratings = reinterpret_cast<const uint8_t*>(column(RV_RATING));
+        return true;
+    }
+
+    int rating(int i) const { return ratings[row(i)]; }
+    FieldView productID(int i) const { return productIDs.get(row(i)); }
+    FieldView customerID(int i) const { return customerIDs.get(row(i)); }
+    FieldView reviewText(int i) const { return texts.get(row(i)); }
+};
+
+#endif // COLUMNAR_CACHE_HPP
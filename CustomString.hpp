@@ -4,46 +4,117 @@
 #include <cstring>
 #include <iostream>
 #include <cctype>
+#include <cstdint>
+#include "SimdText.hpp"
+#include "Hash.hpp"
 
+// String either owns its bytes or borrows them from longer-lived storage
+// such as an Arena. Copies of a borrowed string share the bytes, so copying
+// records whose fields live in an arena does not allocate. Mutating calls
+// take a private copy first.
+//
+// The length is always known and a 64-bit hash is computed on first use and
+// cached, so comparisons reject on length or hash before touching the bytes
+// and hash-based containers can reuse the hash instead of rehashing.
 class String {
 private:
     char* data;
     size_t length;
+    mutable uint64_t hashValue;  // 0 until hash() is first called
+    bool owned;
 
-public:
-    String() : data(new char[1]), length(0) {
-        data[0] = '\0';
+    static char* emptyBuffer() {
+        static char empty[1] = {'\0'};
+        return empty;
+    }
+
+    void assignCopy(const char* str, size_t len) {
+        data = new char[len + 1];
+        memcpy(data, str, len);
+        data[len] = '\0';
+        length = len;
+        hashValue = 0;
+        owned = true;
+    }
+
+    void assignFrom(const String& other) {
+        if (other.owned) {
+            assignCopy(other.data, other.length);
+        } else {
+            data = other.data;
+            length = other.length;
+            owned = false;
+        }
+        hashValue = other.hashValue;
+    }
+
+    void release() {
+        if (owned) delete[] data;
+    }
+
+    // Gives this string its own bytes before they are modified; the cached
+    // hash is dropped because the caller is about to change them
+    void detach() {
+        if (!owned) assignCopy(data, length);
+        hashValue = 0;
     }
 
+public:
+    String() : data(emptyBuffer()), length(0), hashValue(0), owned(false) {}
+
     String(const char* str) {
-        length = strlen(str);
-        data = new char[length + 1];
-        strcpy(data, str);
+        assignCopy(str, strlen(str));
     }
 
     String(const char* str, size_t len) {
-        length = len;
-        data = new char[length + 1];
-        strncpy(data, str, length);
-        data[length] = '\0';
+        assignCopy(str, len);
     }
 
     String(const String& other) {
-        length = other.length;
-        data = new char[length + 1];
-        strcpy(data, other.data);
+        assignFrom(other);
+    }
+
+    // Takes other's bytes, leaving it empty
+    String(String&& other) noexcept
+        : data(other.data), length(other.length), hashValue(other.hashValue), owned(other.owned) {
+        other.data = emptyBuffer();
+        other.length = 0;
+        other.hashValue = 0;
+        other.owned = false;
     }
 
     ~String() {
-        delete[] data;
+        release();
+    }
+
+    // Non-owning string over len bytes at str, which must be followed by '\0'
+    // and outlive every copy of the result
+    static String borrow(const char* str, size_t len) {
+        String result;
+        result.data = const_cast<char*>(str);
+        result.length = len;
+        return result;
     }
 
     String& operator=(const String& other) {
         if (this != &other) {
-            delete[] data;
+            release();
+            assignFrom(other);
+        }
+        return *this;
+    }
+
+    String& operator=(String&& other) noexcept {
+        if (this != &other) {
+            release();
+            data = other.data;
             length = other.length;
-            data = new char[length + 1];
-            strcpy(data, other.data);
+            hashValue = other.hashValue;
+            owned = other.owned;
+            other.data = emptyBuffer();
+            other.length = 0;
+            other.hashValue = 0;
+            other.owned = false;
         }
         return *this;
     }
@@ -51,28 +122,51 @@ public:
     String operator+(const String& other) const {
         size_t newLength = length + other.length;
         char* newData = new char[newLength + 1];
-        strcpy(newData, data);
-        strcat(newData, other.data);
+        memcpy(newData, data, length);
+        memcpy(newData + length, other.data, other.length + 1);
         String result;
-        delete[] result.data;
         result.data = newData;
         result.length = newLength;
+        result.owned = true;
         return result;
     }
 
+    // Same value as hashBytes(c_str(), size())
+    uint64_t hash() const {
+        if (hashValue == 0) hashValue = hashBytes(data, length);
+        return hashValue;
+    }
+
+    // True if the string holds exactly the len bytes at str; strHash is
+    // hashBytes(str, len), computed once by the caller for many comparisons
+    bool equals(const char* str, size_t len, uint64_t strHash) const {
+        return length == len && hash() == strHash && memcmp(data, str, len) == 0;
+    }
+
     bool operator==(const String& other) const {
-        return strcmp(data, other.data) == 0;
+        if (length != other.length) return false;
+        if (hashValue != 0 && other.hashValue != 0 && hashValue != other.hashValue) return false;
+        return memcmp(data, other.data, length) == 0;
+    }
+
+    // Byte order; a string sorts before any longer string it is a prefix of
+    int compare(const String& other) const {
+        size_t n = length < other.length ? length : other.length;
+        int cmp = memcmp(data, other.data, n);
+        if (cmp != 0) return cmp;
+        return length < other.length ? -1 : (length > other.length ? 1 : 0);
     }
 
     bool operator>(const String& other) const {
-        return strcmp(data, other.data) > 0;
+        return compare(other) > 0;
     }
 
     bool operator<(const String& other) const {
-        return strcmp(data, other.data) < 0;
+        return compare(other) < 0;
     }
 
     char& operator[](size_t index) {
+        detach();
         return data[index];
     }
 
@@ -88,12 +182,13 @@ public:
         return data;
     }
 
+    bool isBorrowed() const {
+        return !owned;
+    }
+
     void toLower() {
-        for (size_t i = 0; i < length; i++) {
-            if (data[i] >= 'A' && data[i] <= 'Z') {
-                data[i] = data[i] + ('a' - 'A');
-            }
-        }
+        detach();
+        asciiLower(data, length);
     }
 
     String trim() const {
@@ -113,170 +208,174 @@ public:
     friend std::istream& operator>>(std::istream& is, String& str) {
         char buffer[1024];
         is >> buffer;
-        delete[] str.data;
-        str.length = strlen(buffer);
-        str.data = new char[str.length + 1];
-        strcpy(str.data, buffer);
+        str.release();
+        str.assignCopy(buffer, strlen(buffer));
         return is;
     }
     
 };
 
-// Custom string implementation using linked list
-struct CharNode {
-    char data;
-    CharNode* next;
-    CharNode(char c) : data(c), next(nullptr) {}
-};
-
+// Contiguous string with small-string optimisation: up to LOCAL_CAPACITY
+// characters are stored inline, longer strings in one heap buffer. The
+// bytes are always '\0'-terminated and can be walked with begin()/end().
 class MyString {
-    friend MyString cleanWord(const MyString& word);
-    friend void processReviewText(const MyString& text);
-    CharNode* head;
-    
-    public:
-    MyString() : head(nullptr) {}
-    
-    MyString(const char* str) : head(nullptr) {
-        if (!str) return;
-        CharNode* current = nullptr;
-        while (*str) {
-            CharNode* newNode = new CharNode(*str);
-            if (!head) {
-                head = newNode;
-                current = head;
-            } else {
-                current->next = newNode;
-                current = newNode;
-            }
-            str++;
-        }
+    static const size_t LOCAL_CAPACITY = 15;
+
+    char* ptr;      // Points at local while the string is small
+    size_t len;
+    union {
+        char local[LOCAL_CAPACITY + 1];
+        size_t cap;     // Heap capacity, excluding the terminator
+    };
+
+    bool isLocal() const { return ptr == local; }
+
+    size_t capacity() const { return isLocal() ? LOCAL_CAPACITY : cap; }
+
+    void init(const char* str, size_t n) {
+        ptr = local;
+        len = 0;
+        local[0] = '\0';
+        append(str, n);
     }
-    
-    MyString(const MyString& other) : head(nullptr) {
-        CharNode* otherCurrent = other.head;
-        CharNode* current = nullptr;
-        while (otherCurrent) {
-            CharNode* newNode = new CharNode(otherCurrent->data);
-            if (!head) {
-                head = newNode;
-                current = head;
-            } else {
-                current->next = newNode;
-                current = newNode;
-            }
-            otherCurrent = otherCurrent->next;
+
+    void freeHeap() {
+        if (!isLocal()) delete[] ptr;
+    }
+
+    // Takes other's bytes, leaving it empty
+    void steal(MyString& other) {
+        if (other.isLocal()) {
+            ptr = local;
+            memcpy(local, other.local, other.len + 1);
+        } else {
+            ptr = other.ptr;
+            cap = other.cap;
+            other.ptr = other.local;
         }
+        len = other.len;
+        other.len = 0;
+        other.local[0] = '\0';
     }
-    
+
+public:
+    MyString() : ptr(local), len(0) {
+        local[0] = '\0';
+    }
+
+    MyString(const char* str) {
+        init(str, str ? strlen(str) : 0);
+    }
+
+    MyString(const char* str, size_t n) {
+        init(str, n);
+    }
+
+    MyString(const MyString& other) {
+        init(other.ptr, other.len);
+    }
+
+    MyString(MyString&& other) noexcept {
+        steal(other);
+    }
+
     ~MyString() {
-        while (head) {
-            CharNode* temp = head;
-            head = head->next;
-            delete temp;
-        }
+        freeHeap();
     }
-    
+
     MyString& operator=(const MyString& other) {
         if (this != &other) {
-            this->~MyString();
-            head = nullptr;
-            CharNode* otherCurrent = other.head;
-            CharNode* current = nullptr;
-            while (otherCurrent) {
-                CharNode* newNode = new CharNode(otherCurrent->data);
-                if (!head) {
-                    head = newNode;
-                    current = head;
-                } else {
-                    current->next = newNode;
-                    current = newNode;
-                }
-                otherCurrent = otherCurrent->next;
-            }
+            clear();
+            append(other.ptr, other.len);
         }
         return *this;
     }
-    
-    bool operator==(const MyString& other) const {
-        CharNode* curr1 = head;
-        CharNode* curr2 = other.head;
-        while (curr1 && curr2) {
-            if (curr1->data != curr2->data) return false;
-            curr1 = curr1->next;
-            curr2 = curr2->next;
+
+    MyString& operator=(MyString&& other) noexcept {
+        if (this != &other) {
+            freeHeap();
+            steal(other);
         }
-        return curr1 == curr2; // both should be nullptr
+        return *this;
     }
-    
+
+    // Grows the buffer to hold at least n characters
+    void reserve(size_t n) {
+        if (n <= capacity()) return;
+        size_t newCap = capacity() * 2;
+        if (newCap < n) newCap = n;
+        char* bigger = new char[newCap + 1];
+        memcpy(bigger, ptr, len + 1);
+        freeHeap();
+        ptr = bigger;
+        cap = newCap;
+    }
+
+    void append(const char* str, size_t n) {
+        reserve(len + n);
+        if (n) memcpy(ptr + len, str, n);
+        len += n;
+        ptr[len] = '\0';
+    }
+
+    void push_back(char c) {
+        if (len == capacity()) reserve(len + 1);
+        ptr[len++] = c;
+        ptr[len] = '\0';
+    }
+
+    // Empties the string but keeps its buffer for reuse
+    void clear() {
+        len = 0;
+        ptr[0] = '\0';
+    }
+
+    // Character access for fast iteration
+    size_t size() const { return len; }
+    const char* c_str() const { return ptr; }
+    const char* begin() const { return ptr; }
+    const char* end() const { return ptr + len; }
+    char operator[](size_t index) const { return ptr[index]; }
+
+    bool operator==(const MyString& other) const {
+        return len == other.len && memcmp(ptr, other.ptr, len) == 0;
+    }
+
     bool operator<(const MyString& other) const {
-        CharNode* curr1 = head;
-        CharNode* curr2 = other.head;
-        while (curr1 && curr2) {
-            if (curr1->data != curr2->data)
-                return curr1->data < curr2->data;
-            curr1 = curr1->next;
-            curr2 = curr2->next;
-        }
-        return !curr1 && curr2; // shorter string is less
+        size_t n = len < other.len ? len : other.len;
+        int cmp = memcmp(ptr, other.ptr, n);
+        return cmp != 0 ? cmp < 0 : len < other.len; // shorter string is less
     }
-    
+
     bool operator>(const MyString& other) const {
         return other < *this;
     }
-    
+
     friend std::ostream& operator<<(std::ostream& os, const MyString& str) {
-        CharNode* current = str.head;
-        while (current) {
-            os << current->data;
-            current = current->next;
-        }
+        os.write(str.ptr, static_cast<std::streamsize>(str.len));
         return os;
     }
-    
+
+    // Reads characters up to the next whitespace
     friend std::istream& operator>>(std::istream& is, MyString& str) {
         char c;
-        str.~MyString();
-        str.head = nullptr;
-        CharNode* current = nullptr;
-        while (is.get(c) && !isspace(c)) {
-            CharNode* newNode = new CharNode(c);
-            if (!str.head) {
-                str.head = newNode;
-                current = str.head;
-            } else {
-                current->next = newNode;
-                current = newNode;
-            }
+        str.clear();
+        while (is.get(c) && !isspace(static_cast<unsigned char>(c))) {
+            str.push_back(c);
         }
         return is;
     }
 
     MyString operator+(const MyString& other) const {
-        MyString result(*this);
-        if (!other.head) return result;
-        
-        CharNode* current = result.head;
-        if (!current) {
-            result = other;
-            return result;
-        }
-        
-        while (current->next) {
-            current = current->next;
-        }
-        
-        CharNode* otherCurrent = other.head;
-        while (otherCurrent) {
-            current->next = new CharNode(otherCurrent->data);
-            current = current->next;
-            otherCurrent = otherCurrent->next;
-        }
+        MyString result;
+        result.reserve(len + other.len);
+        result.append(ptr, len);
+        result.append(other.ptr, other.len);
         return result;
     }
 
     bool empty() const {
-        return head == nullptr;
+        return len == 0;
     }
 };
 
@@ -0,0 +1,23 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// 64-bit FNV-1a, shared by the state fingerprints and the hash tables
+inline uint64_t fnv1a(const char* p, size_t len, uint64_t hash = 1469598103934665603ULL) {
+    for (size_t i = 0; i < len; i++) {
+        hash ^= static_cast<unsigned char>(p[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Hash of a string for the hash tables and String's cached hash. Never 0,
+// so 0 can mean "not computed yet".
+inline uint64_t hashBytes(const char* p, size_t len) {
+    uint64_t hash = fnv1a(p, len);
+    return hash != 0 ? hash : 1;
+}
+
+#endif // HASH_HPP
@@ -0,0 +1,245 @@
+#ifndef INCREMENTAL_INGEST_HPP
+#define INCREMENTAL_INGEST_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include "Array.hpp"
+#include "Algorithms.hpp"
+#include "CSVReader.hpp"
+#include "Hash.hpp"
+
+// Append-mode ingestion for the clean CSVs. A state file remembers how far
+// each CSV has been consumed plus the results derived from it, so a rerun
+// only parses rows appended since then.
+//
+// A cursor is trusted only if the file has not shrunk and a fingerprint of
+// the consumed prefix still matches. The fingerprint hashes the first and
+// the last few KB before the cursor rather than the whole prefix: that keeps
+// a rerun proportional to the new data and still catches a rewritten header
+// or an edited tail, which is how an append-only file gets replaced.
+
+const char INGEST_MAGIC[4] = {'D', 'S', 'I', 'S'};
+const uint32_t INGEST_VERSION = 1;
+const uint64_t INGEST_HEAD_BYTES = 4096;
+const uint64_t INGEST_TAIL_BYTES = 64 * 1024;
+
+// How far a CSV has been consumed, and what its prefix looked like
+struct TailCursor {
+    uint64_t offset;     // First byte not yet parsed; always just after a newline
+    uint64_t headHash;   // Hash of the first INGEST_HEAD_BYTES before offset
+    uint64_t tailHash;   // Hash of the last INGEST_TAIL_BYTES before offset
+
+    TailCursor() : offset(0), headHash(0), tailHash(0) {}
+};
+
+// Fingerprints the first offset bytes of the mapping into cursor
+inline void stampCursor(const MappedFile& file, uint64_t offset, TailCursor& cursor) {
+    uint64_t head = offset < INGEST_HEAD_BYTES ? offset : INGEST_HEAD_BYTES;
+    uint64_t tail = offset < INGEST_TAIL_BYTES ? offset : INGEST_TAIL_BYTES;
+    cursor.offset = offset;
+    cursor.headHash = fnv1a(file.begin(), head);
+    cursor.tailHash = fnv1a(file.begin() + (offset - tail), tail);
+}
+
+// True if the file still starts with the bytes the cursor was stamped from
+inline bool cursorMatches(const MappedFile& file, const TailCursor& cursor) {
+    if (cursor.offset > file.size()) return false;
+    TailCursor now;
+    stampCursor(file, cursor.offset, now);
+    return now.headHash == cursor.headHash && now.tailHash == cursor.tailHash;
+}
+
+// Byte range of complete rows appended after the cursor. A trailing line
+// without its newline may still be being written, so it is left for the
+// next run. If the cursor no longer matches, cursor is reset, the range
+// covers the whole file and false is returned so the caller can drop
+// whatever it derived from the old contents.
+inline bool newRows(const MappedFile& file, TailCursor& cursor, const char*& begin, const char*& end) {
+    bool resumed = cursor.offset > 0 && cursorMatches(file, cursor);
+    if (!resumed) cursor = TailCursor();
+
+    begin = file.begin() + cursor.offset;
+    end = begin;
+    for (const char* p = file.end(); p > begin; p--) {
+        if (p[-1] == '\n') {
+            end = p;
+            break;
+        }
+    }
+    return resumed;
+}
+
+// Moves the cursor to end (a pointer into the same mapping)
+inline void advanceCursor(const MappedFile& file, const char* end, TailCursor& cursor) {
+    stampCursor(file, static_cast<uint64_t>(end - file.begin()), cursor);
+}
+
+// One transaction in date order: its date key and where its row starts
+struct DateIndexEntry {
+    uint32_t dateKey;
+    uint32_t reserved;
+    uint64_t rowOffset;
+
+    DateIndexEntry() : dateKey(0), reserved(0), rowOffset(0) {}
+    DateIndexEntry(uint32_t key, uint64_t offset) : dateKey(key), reserved(0), rowOffset(offset) {}
+
+    // Equal dates keep file order, so merging stays stable
+    bool operator>(const DateIndexEntry& other) const {
+        return dateKey != other.dateKey ? dateKey > other.dateKey : rowOffset > other.rowOffset;
+    }
+    bool operator<(const DateIndexEntry& other) const {
+        return other > *this;
+    }
+};
+
+// Sorts the newly added entries and merges them into the persisted order
+inline void mergeDateOrder(Array<DateIndexEntry>& order, Array<DateIndexEntry>& added) {
+    if (added.empty()) return;
+    mergeSortArray(added, 0, added.getSize() - 1);
+
+    Array<DateIndexEntry> merged(order.getSize() + added.getSize());
+    int i = 0, j = 0;
+    while (i < order.getSize() && j < added.getSize()) {
+        if (!(order[i] > added[j])) merged.push_back(order[i++]);
+        else merged.push_back(added[j++]);
+    }
+    while (i < order.getSize()) merged.push_back(order[i++]);
+    while (j < added.getSize()) merged.push_back(added[j++]);
+    order = std::move(merged);
+}
+
+struct WordCount {
+    std::string word;
+    int64_t count;
+
+    WordCount() : count(0) {}
+    WordCount(const std::string& w, int64_t c) : word(w), count(c) {}
+};
+
+// Everything derived from the two clean CSVs, plus how far each was read
+class IngestState {
+private:
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        TailCursor transactions;
+        TailCursor reviews;
+        int64_t transactionCount;
+        int64_t electronicsCount;
+        int64_t electronicsCreditCount;
+        int64_t reviewCount;
+        uint32_t wordCount;
+        uint32_t dateCount;
+    };
+
+public:
+    TailCursor transactionCursor;
+    TailCursor reviewCursor;
+    int64_t transactionCount;
+    int64_t electronicsCount;
+    int64_t electronicsCreditCount;
+    int64_t reviewCount;
+    Array<WordCount> words;             // Word frequencies from 1-star reviews
+    Array<DateIndexEntry> dateOrder;    // All transactions, sorted by date
+
+    IngestState() : transactionCount(0), electronicsCount(0), electronicsCreditCount(0), reviewCount(0) {}
+
+    void resetTransactions() {
+        transactionCursor = TailCursor();
+        transactionCount = electronicsCount = electronicsCreditCount = 0;
+        dateOrder = Array<DateIndexEntry>();
+    }
+
+    void resetReviews() {
+        reviewCursor = TailCursor();
+        reviewCount = 0;
+        words = Array<WordCount>();
+    }
+
+    // Returns false (leaving the state empty) if the file is missing or unreadable
+    bool load(const char* path) {
+        resetTransactions();
+        resetReviews();
+        MappedFile file;
+        if (!file.open(path) || file.size() < sizeof(Header)) return false;
+
+        Header h;
+        memcpy(&h, file.begin(), sizeof(h));
+        if (memcmp(h.magic, INGEST_MAGIC, sizeof(INGEST_MAGIC)) != 0 || h.version != INGEST_VERSION) return false;
+
+        const char* p = file.begin() + sizeof(h);
+        const char* end = file.end();
+        Array<WordCount> loadedWords(h.wordCount > 0 ? h.wordCount : 1);
+        for (uint32_t i = 0; i < h.wordCount; i++) {
+            uint32_t len;
+            int64_t count;
+            if (end - p < static_cast<long>(sizeof(len) + sizeof(count))) return false;
+            memcpy(&len, p, sizeof(len));
+            memcpy(&count, p + sizeof(len), sizeof(count));
+            p += sizeof(len) + sizeof(count);
+            if (static_cast<uint64_t>(end - p) < len) return false;
+            loadedWords.push_back(WordCount(std::string(p, len), count));
+            p += len;
+        }
+
+        if (static_cast<uint64_t>(end - p) < static_cast<uint64_t>(h.dateCount) * sizeof(DateIndexEntry)) return false;
+        Array<DateIndexEntry> loadedOrder(h.dateCount > 0 ? h.dateCount : 1);
+        for (uint32_t i = 0; i < h.dateCount; i++) {
+            DateIndexEntry e;
+            memcpy(&e, p, sizeof(e));
+            p += sizeof(e);
+            loadedOrder.push_back(e);
+        }
+
+        transactionCursor = h.transactions;
+        reviewCursor = h.reviews;
+        transactionCount = h.transactionCount;
+        electronicsCount = h.electronicsCount;
+        electronicsCreditCount = h.electronicsCreditCount;
+        reviewCount = h.reviewCount;
+        words = std::move(loadedWords);
+        dateOrder = std::move(loadedOrder);
+        return true;
+    }
+
+    // Writes to a temporary file first so an interrupted run keeps the old state
+    bool save(const char* path) const {
+        Header h = Header();
+        memcpy(h.magic, INGEST_MAGIC, sizeof(INGEST_MAGIC));
+        h.version = INGEST_VERSION;
+        h.transactions = transactionCursor;
+        h.reviews = reviewCursor;
+        h.transactionCount = transactionCount;
+        h.electronicsCount = electronicsCount;
+        h.electronicsCreditCount = electronicsCreditCount;
+        h.reviewCount = reviewCount;
+        h.wordCount = static_cast<uint32_t>(words.getSize());
+        h.dateCount = static_cast<uint32_t>(dateOrder.getSize());
+
+        std::string tmpPath = std::string(path) + ".tmp";
+        {
+            std::ofstream out(tmpPath.c_str(), std::ios::binary);
+            if (!out.is_open()) return false;
+            out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+            for (int i = 0; i < words.getSize(); i++) {
+                uint32_t len = static_cast<uint32_t>(words[i].word.size());
+                out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+                out.write(reinterpret_cast<const char*>(&words[i].count), sizeof(words[i].count));
+                out.write(words[i].word.data(), len);
+            }
+            for (int i = 0; i < dateOrder.getSize(); i++) {
+                out.write(reinterpret_cast<const char*>(&dateOrder[i]), sizeof(DateIndexEntry));
+            }
+            if (!out.good()) return false;
+        }
+#ifdef _WIN32
+        std::remove(path); // rename does not replace an existing file on Windows
+#endif
+        return std::rename(tmpPath.c_str(), path) == 0;
+    }
+};
+
+#endif // INCREMENTAL_INGEST_HPP
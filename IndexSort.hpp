@@ -0,0 +1,93 @@
+#ifndef INDEX_SORT_HPP
+#define INDEX_SORT_HPP
+
+#include <type_traits>
+#include <utility>
+#include "Array.hpp"
+
+// Sorting by permutation: instead of moving whole records on every swap or
+// merge step, sort a compact array of (key, row index) pairs and then either
+// reorder the records once (applyOrder) or read them through the
+// permutation (SortedView). A sort step then moves an 8-byte (dateKey,
+// index) pair instead of a whole Transaction and its date string.
+
+// Sort key of one row plus the row's position. Ties on key are broken by
+// index, so every pair is distinct and any sort, stable or not, yields the
+// order a stable sort by key would.
+template<typename Key>
+struct KeyIndex {
+    Key key;
+    int index;
+
+    bool operator>(const KeyIndex& other) const {
+        return other.key < key || (!(key < other.key) && index > other.index);
+    }
+
+    bool operator<(const KeyIndex& other) const {
+        return key < other.key || (!(other.key < key) && index < other.index);
+    }
+};
+
+// (keyOf(base[i]), i) for the n rows starting at base
+template<typename It, typename KeyFn>
+auto makeKeyIndex(It base, int n, KeyFn keyOf) -> Array<KeyIndex<typename std::decay<decltype(keyOf(*base))>::type>> {
+    typedef typename std::decay<decltype(keyOf(*base))>::type Key;
+    Array<KeyIndex<Key>> pairs(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        pairs.push_back(KeyIndex<Key>{keyOf(base[i]), i});
+    }
+    return pairs;
+}
+
+// The row indices of sorted pairs, in order
+template<typename Key>
+Array<int> orderOf(const Array<KeyIndex<Key>>& pairs) {
+    Array<int> order(pairs.getSize() > 0 ? pairs.getSize() : 1);
+    for (int i = 0; i < pairs.getSize(); i++) {
+        order.push_back(pairs[i].index);
+    }
+    return order;
+}
+
+// Reorders the rows at base so that row i becomes the old row order[i].
+// Follows the permutation's cycles, so each row is moved once (plus one
+// temporary per cycle) and no second buffer of rows is needed. order is
+// consumed: it is left as the identity.
+template<typename It>
+void applyOrder(It base, Array<int>& order) {
+    int* next = order.data();
+    int n = order.getSize();
+    for (int start = 0; start < n; start++) {
+        if (next[start] == start) continue;
+        auto carried = std::move(base[start]);
+        int hole = start;
+        while (next[hole] != start) {
+            int from = next[hole];
+            base[hole] = std::move(base[from]);
+            next[hole] = hole;
+            hole = from;
+        }
+        base[hole] = std::move(carried);
+        next[hole] = hole;
+    }
+}
+
+// Read-only view of rows in sorted order; the rows themselves stay put
+template<typename It>
+class SortedView {
+private:
+    It base;
+    Array<int> order;
+
+public:
+    SortedView(It rows, Array<int>&& sortedOrder) : base(rows), order(std::move(sortedOrder)) {}
+
+    auto operator[](int i) const -> decltype(base[0]) { return base[order[i]]; }
+
+    // Position of the i-th sorted row in the underlying rows
+    int rowIndex(int i) const { return order[i]; }
+
+    int getSize() const { return order.getSize(); }
+};
+
+#endif // INDEX_SORT_HPP
@@ -1,8 +1,18 @@
 #include "LinkedList.hpp"
 #include "CustomString.hpp"
 #include "Array.hpp"
+#include "SegmentedArray.hpp"
 #include "StringUtils.hpp"
 #include "Algorithms.hpp"
+#include "ParallelLoader.hpp"
+#include "CleanPipeline.hpp"
+#include "ColumnarCache.hpp"
+#include "NumberParse.hpp"
+#include "IncrementalIngest.hpp"
+#include "Arena.hpp"
+#include "SymbolTable.hpp"
+#include "WordTokenizer.hpp"
+#include "WordCountMap.hpp"
 #include <iostream>
 #include <fstream>
 #include <chrono>
@@ -10,28 +20,35 @@
 #include <stdexcept>
 #include <cmath>
 
-// Structure to store transaction data
+// Structure to store transaction data; IDs, category and payment method
+// are interned symbols (see SymbolTable.hpp)
 struct Transaction {
-    String customerId;
-    String productId;
-    double price;
+    Symbol customerId;
+    Symbol productId;
+    int64_t priceCents;
     String date;
-    String category;
-    String paymentMethod;
+    uint32_t dateKey;  // YYYYMMDD, so dates order as integers
+    Symbol category;
+    Symbol paymentMethod;
 
     bool operator>(const Transaction& other) const {
-        return date > other.date;
+        return dateKey > other.dateKey;
     }
 
     bool operator<(const Transaction& other) const {
-        return date < other.date;
+        return dateKey < other.dateKey;
     }
 };
 
+// Sort key of a transaction, for the key/index sorts
+inline uint32_t transactionDateKey(const Transaction& t) {
+    return t.dateKey;
+}
+
 // Structure to store review data
 struct Review {
-    String productId;
-    String customerId;
+    Symbol productId;
+    Symbol customerId;
     int rating;
     String reviewText;
 
@@ -49,6 +66,8 @@ struct WordFreq {
     String word;
     int frequency;
 
+    WordFreq() : frequency(0) {}
+
     bool operator>(const WordFreq& other) const {
         // Sort by frequency in descending order
         if (frequency != other.frequency) {
@@ -73,193 +92,383 @@ struct WordFreq {
     }
 };
 
-// Helper function to process a single word
-void processWord(String& word, LinkedList<WordFreq>& wordFrequencies) {
-    // Skip empty words or words with non-printable characters
-    if (word.size() == 0) return;
-    
-    // Convert to lowercase
-    word.toLower();
-    
-    // Skip words that are just numbers or special characters
-    bool hasLetter = false;
-    const char* str = word.c_str();
-    for (size_t i = 0; i < strlen(str); i++) {
-        if (isalpha(str[i])) {
-            hasLetter = true;
-            break;
-        }
-    }
-    if (!hasLetter) return;
+// Helper function to count a single word (already lowercased by the tokenizer)
+void processWord(const WordToken& word, WordCountMap& wordFrequencies) {
+    // Skip words that are just numbers
+    if (!word.hasLetter) return;
     
-    // Add or update word frequency
-    bool found = false;
-    for (auto it = wordFrequencies.begin(); it != wordFrequencies.end(); ++it) {
-        if (it->word == word) {
-            it->frequency++;
-            found = true;
-            break;
-        }
-    }
-    if (!found) {
+    wordFrequencies.increment(word.ptr, word.len);
+}
+
+// Helper function to copy the counted words into an array, most frequent first
+void sortedWordArray(const WordCountMap& wordFrequencies, Array<WordFreq>& sortedWords) {
+    Array<WordCountMap::Entry> entries;
+    wordFrequencies.topK(-1, entries);
+    sortedWords.reserve(entries.getSize());
+    for (int i = 0; i < entries.getSize(); i++) {
         WordFreq wf;
-        wf.word = word;
-        wf.frequency = 1;
-        wordFrequencies.insert(wf);
+        wf.word = String(entries[i].word, entries[i].length);
+        wf.frequency = static_cast<int>(entries[i].count);
+        sortedWords.push_back(std::move(wf));
     }
 }
 
-// Helper function to safely convert string to double
-double safeStod(const String& str) {
-    try {
-        return std::stod(str.c_str());
-    } catch (const std::invalid_argument& e) {
-        std::cerr << "Error: Invalid number format in transaction price: " << str << std::endl;
-        return 0.0;
-    } catch (const std::out_of_range& e) {
-        std::cerr << "Error: Number out of range in transaction price: " << str << std::endl;
-        return 0.0;
+// Helper function to read a price field as cents (0 and an error message if invalid)
+int64_t readPriceCents(const FieldView& field) {
+    int64_t cents;
+    NumberStatus status = parsePriceCents(field.ptr, field.len, cents);
+    if (status != NUM_OK) {
+        std::cerr << "Error: " << numberStatusText(status) << " in transaction price: " << field.str() << std::endl;
     }
+    return cents;
 }
 
-// Helper function to safely convert string to int
-int safeStoi(const String& str) {
-    try {
-        return std::stoi(str.c_str());
-    } catch (const std::invalid_argument& e) {
-        std::cerr << "Error: Invalid number format in review rating: " << str << std::endl;
-        return 0;
-    } catch (const std::out_of_range& e) {
-        std::cerr << "Error: Number out of range in review rating: " << str << std::endl;
-        return 0;
+// Helper function to read a date field as a YYYYMMDD key (0 and an error message if invalid)
+uint32_t readDateKey(const FieldView& field) {
+    uint32_t key;
+    NumberStatus status = parseDateKey(field.ptr, field.len, key);
+    if (status != NUM_OK) {
+        std::cerr << "Error: Invalid date in transaction: " << field.str() << std::endl;
     }
+    return key;
 }
 
-// Helper function to split customer and product ID
-void splitCustomerProduct(const String& combined, String& customerId, String& productId) {
-    const char* str = combined.c_str();
-    String temp = "";
-    bool foundPipe = false;
-    
-    for (size_t i = 0; i < strlen(str); i++) {
-        if (str[i] == '|') {
-            customerId = temp;
-            temp = "";
-            foundPipe = true;
-        } else {
-            char c[2] = {str[i], '\0'};
-            temp = temp + String(c);
-        }
+// Helper function to read a rating field (0 and an error message if invalid)
+int readRating(const FieldView& field) {
+    uint8_t rating;
+    NumberStatus status = parseRating(field.ptr, field.len, rating);
+    if (status != NUM_OK) {
+        std::cerr << "Error: " << numberStatusText(status) << " in review rating: " << field.str() << std::endl;
     }
-    if (foundPipe) {
-        productId = temp;
+    return rating;
+}
+
+// Helper function to split customer and product ID
+void splitCustomerProduct(const FieldView& combined, Symbol& customerId, Symbol& productId) {
+    long pipe = combined.find('|');
+    if (pipe >= 0) {
+        customerId = intern(combined.substr(0, pipe));
+        productId = intern(combined.substr(pipe + 1, combined.size()));
+    } else {
+        customerId = intern("");
+        productId = intern("");
     }
 }
 
+// Helper function to tell whether a transaction is an Electronics purchase
+// and whether it was paid by Credit Card (integer compares on symbols)
+bool isElectronics(const Transaction& t) {
+    static const Symbol electronics = intern("Electronics");
+    return t.category == electronics;
+}
+
+bool isCreditCard(const Transaction& t) {
+    static const Symbol creditCard = intern("Credit Card");
+    return t.paymentMethod == creditCard;
+}
+
+// Helper function to parse a transaction row (runs on loader threads)
+bool parseTransaction(const CSVRow& parts, Transaction& t, Arena& arena) {
+    if (parts.getSize() < 5) return false;  // Changed from 6 to 5 due to combined customer|product field
+    splitCustomerProduct(parts[0], t.customerId, t.productId);
+    t.category = intern(parts[1]);
+    t.priceCents = readPriceCents(parts[2]);
+    t.date = toString(parts[3], arena);
+    t.dateKey = readDateKey(parts[3]);
+    t.paymentMethod = intern(parts[4]);
+    return true;
+}
+
 // Helper function to process transactions
-void processTransaction(const StringArray& parts, LinkedList<Transaction>& transactions,
+void processTransaction(const Transaction& t, LinkedList<Transaction>& transactions,
                       int& totalTransactions, int& electronicsCredit, int& totalElectronics) {
-    if (parts.getSize() >= 5) {  // Changed from 6 to 5 due to combined customer|product field
+    transactions.insert(t);
+    totalTransactions++;
+
+    if (isElectronics(t)) {
+        totalElectronics++;
+        if (isCreditCard(t)) {
+            electronicsCredit++;
+        }
+    }
+}
+
+// Helper function to parse a review row (runs on loader threads)
+bool parseReview(const CSVRow& parts, Review& r, Arena& arena) {
+    if (parts.getSize() < 4) return false;
+    r.productId = intern(parts[0]);
+    r.customerId = intern(parts[1]);
+    r.rating = readRating(parts[2]);
+    r.reviewText = toString(parts[3], arena);
+    return true;
+}
+
+// Pipeline mode: cleans transactions.csv in memory, optionally writing transactionsClean.csv
+bool loadRawTransactions(Array<Transaction>& out, Arena& arena, bool writeClean) {
+    CSVReader rawFile("transactions.csv");
+    if (!rawFile.isOpen()) {
+        std::cerr << "Error: Could not open transactions.csv" << std::endl;
+        return false;
+    }
+    std::ofstream cleanFile;
+    if (writeClean) cleanFile.open("transactionsClean.csv");
+
+    // The row count is unknown until the end, so collect into blocks first
+    SegmentedArray<Transaction> rows;
+    runTransactionPipeline(rawFile, [&](const CleanTransaction& c) {
         Transaction t;
-        String combined = parts[0];
-        splitCustomerProduct(combined, t.customerId, t.productId);
-        t.category = parts[1];
-        t.price = safeStod(parts[2]);
-        t.date = parts[3];
-        t.paymentMethod = parts[4];
-        
-        transactions.insert(t);
-        totalTransactions++;
-
-        if (t.category == String("Electronics")) {
-            totalElectronics++;
-            if (t.paymentMethod == String("Credit Card")) {
-                electronicsCredit++;
-            }
+        t.customerId = intern(c.customerID);
+        t.productId = intern(c.product);
+        t.category = intern(c.category);
+        t.priceCents = c.priceCents;
+        t.date = toString(c.date.data(), c.date.size(), arena);
+        t.dateKey = c.dateKey;
+        t.paymentMethod = intern(c.paymentMethod);
+        rows.push_back(std::move(t));
+    }, writeClean ? &cleanFile : nullptr, nullptr);
+    rows.moveTo(out);
+    return true;
+}
+
+// Pipeline mode: cleans reviews.csv in memory, optionally writing reviewsClean.csv
+bool loadRawReviews(Array<Review>& out, Arena& arena, bool writeClean) {
+    CSVReader rawFile("reviews.csv");
+    if (!rawFile.isOpen()) {
+        std::cerr << "Error: Could not open reviews.csv" << std::endl;
+        return false;
+    }
+    std::ofstream cleanFile;
+    if (writeClean) cleanFile.open("reviewsClean.csv");
+
+    // The row count is unknown until the end, so collect into blocks first
+    SegmentedArray<Review> rows;
+    runReviewPipeline(rawFile, [&](const CleanReview& c) {
+        Review r;
+        r.productId = intern(c.productID);
+        r.customerId = intern(c.customerID);
+        r.rating = c.rating;
+        r.reviewText = toString(c.reviewText.data(), c.reviewText.size(), arena);
+        rows.push_back(std::move(r));
+    }, writeClean ? &cleanFile : nullptr, nullptr);
+    rows.moveTo(out);
+    return true;
+}
+
+// Cache path: fills records straight from the binary columns, no text parsing.
+// Returns false if the cache is missing or stale so the CSV is used instead.
+bool loadTransactionCache(Array<Transaction>& out, Arena& arena) {
+    TransactionCache cache;
+    if (!cache.open("transactionsClean.bin", "transactionsClean.csv")) return false;
+    char date[11];
+    for (int i = 0; i < cache.getSize(); i++) {
+        Transaction t;
+        t.customerId = intern(cache.customerID(i));
+        t.productId = intern(cache.product(i));
+        t.category = intern(cache.category(i));
+        t.priceCents = cache.priceCents(i);
+        formatDateKey(cache.dateKey(i), date);
+        t.date = toString(date, 10, arena);
+        t.dateKey = cache.dateKey(i);
+        t.paymentMethod = intern(cache.paymentMethod(i));
+        out.push_back(std::move(t));
+    }
+    std::cout << "Loaded " << cache.getSize() << " transactions from transactionsClean.bin" << std::endl;
+    return true;
+}
+
+bool loadReviewCache(Array<Review>& out, Arena& arena) {
+    ReviewCache cache;
+    if (!cache.open("reviewsClean.bin", "reviewsClean.csv")) return false;
+    for (int i = 0; i < cache.getSize(); i++) {
+        Review r;
+        r.productId = intern(cache.productID(i));
+        r.customerId = intern(cache.customerID(i));
+        r.rating = cache.rating(i);
+        r.reviewText = toString(cache.reviewText(i), arena);
+        out.push_back(std::move(r));
+    }
+    std::cout << "Loaded " << cache.getSize() << " reviews from reviewsClean.bin" << std::endl;
+    return true;
+}
+
+// Helper function to count the words of a review
+void countReviewWords(const Review& r, WordCountMap& wordFrequencies) {
+    // Process only 1-star reviews for word frequency analysis
+    if (r.rating == 1) {
+        // Words end at spaces and punctuation; only letters and digits are kept
+        WordTokenizer tokenizer(r.reviewText.c_str(), r.reviewText.size());
+        WordToken word;
+        while (tokenizer.next(word)) {
+            processWord(word, wordFrequencies);
         }
     }
 }
 
 // Helper function to process reviews
-void processReview(const StringArray& parts, LinkedList<Review>& reviews,
-                  LinkedList<WordFreq>& wordFrequencies) {
-    if (parts.getSize() >= 4) {
-        Review r;
-        r.productId = parts[0];
-        r.customerId = parts[1];
-        r.rating = safeStoi(parts[2]);
-        r.reviewText = parts[3];
-        
-        reviews.insert(r);
-
-        // Process only 1-star reviews for word frequency analysis
-        if (r.rating == 1) {
-            String current = "";
-            const char* cstr = r.reviewText.c_str();
-            
-            for (size_t i = 0; i < strlen(cstr); i++) {
-                // If we hit a space or punctuation, process the current word
-                if (isspace(cstr[i]) || ispunct(cstr[i])) {
-                    if (current.size() > 0) {
-                        processWord(current, wordFrequencies);
-                        current = "";
-                    }
-                } 
-                // Only add alphanumeric characters to the current word
-                else if (isalpha(cstr[i]) || isdigit(cstr[i])) {
-                    char c[2] = {cstr[i], '\0'};
-                    // Convert uppercase to lowercase
-                    if (c[0] >= 'A' && c[0] <= 'Z') {
-                        c[0] = c[0] + ('a' - 'A');
-                    }
-                    current = current + String(c);
-                }
-            }
-            if (strlen(current.c_str()) > 0) {
-                processWord(current, wordFrequencies);
-            }
+void processReview(const Review& r, LinkedList<Review>& reviews,
+                  WordCountMap& wordFrequencies) {
+    reviews.insert(r);
+    countReviewWords(r, wordFrequencies);
+}
+
+// Incremental mode: parses only the rows appended to the clean CSVs since the
+// last run and merges them into the counters, word frequencies and date order
+// kept in ingest.state. A CSV whose prefix changed is reloaded from scratch.
+int runIncremental() {
+    IngestState state;
+    Arena arena;  // Field bytes of the newly parsed rows
+    state.load("ingest.state");
+
+    MappedFile transactionFile("transactionsClean.csv");
+    MappedFile reviewFile("reviewsClean.csv");
+    if (!transactionFile.isOpen() || !reviewFile.isOpen()) {
+        std::cerr << "Error: Could not open transactionsClean.csv/reviewsClean.csv" << std::endl;
+        return 1;
+    }
+
+    // --- Transactions ---
+    const char* begin;
+    const char* end;
+    if (!newRows(transactionFile, state.transactionCursor, begin, end)) state.resetTransactions();
+    bool transactionsResumed = state.transactionCursor.offset > 0;
+    CSVRange transactionRows(begin, end);
+    if (!transactionsResumed) transactionRows.skipLine(); // Header
+
+    CSVRow row;
+    Transaction t;
+    Array<DateIndexEntry> addedDates;
+    while (transactionRows.nextRow(row)) {
+        if (!parseTransaction(row, t, arena)) continue;
+        state.transactionCount++;
+        if (isElectronics(t)) {
+            state.electronicsCount++;
+            if (isCreditCard(t)) state.electronicsCreditCount++;
         }
+        addedDates.emplace_back(t.dateKey, row[0].ptr - transactionFile.begin());
+    }
+    mergeDateOrder(state.dateOrder, addedDates);
+    advanceCursor(transactionFile, end, state.transactionCursor);
+
+    // --- Reviews ---
+    if (!newRows(reviewFile, state.reviewCursor, begin, end)) state.resetReviews();
+    bool reviewsResumed = state.reviewCursor.offset > 0;
+    CSVRange reviewRows(begin, end);
+    if (!reviewsResumed) reviewRows.skipLine(); // Header
+
+    WordCountMap wordFrequencies(state.words.getSize());
+    for (int i = 0; i < state.words.getSize(); i++) {
+        wordFrequencies.increment(state.words[i].word, state.words[i].count);
+    }
+    int addedReviews = 0;
+    Review r;
+    while (reviewRows.nextRow(row)) {
+        if (!parseReview(row, r, arena)) continue;
+        countReviewWords(r, wordFrequencies);
+        addedReviews++;
+    }
+    state.reviewCount += addedReviews;
+    state.words = Array<WordCount>(wordFrequencies.getSize() > 0 ? wordFrequencies.getSize() : 1);
+    for (const WordCountMap::Entry& e : wordFrequencies) {
+        state.words.emplace_back(std::string(e.word, e.length), e.count);
     }
+    advanceCursor(reviewFile, end, state.reviewCursor);
+
+    if (!state.save("ingest.state")) {
+        std::cerr << "Error: Could not write ingest.state" << std::endl;
+        return 1;
+    }
+
+    // --- Report ---
+    std::cout << "Incremental ingest (" << (transactionsResumed ? "appended rows only" : "full reload")
+              << " for transactions, " << (reviewsResumed ? "appended rows only" : "full reload")
+              << " for reviews):" << std::endl;
+    std::cout << "New transactions: " << addedDates.getSize() << ", new reviews: " << addedReviews << std::endl;
+    std::cout << "Total number of transactions: " << state.transactionCount << std::endl;
+    std::cout << "Total number of reviews: " << state.reviewCount << std::endl;
+    if (state.dateOrder.getSize() > 0) {
+        char first[11], last[11];
+        formatDateKey(state.dateOrder[0].dateKey, first);
+        formatDateKey(state.dateOrder[state.dateOrder.getSize() - 1].dateKey, last);
+        std::cout << "Date range: " << first << " to " << last << std::endl;
+    }
+
+    double percentage = state.electronicsCount > 0 ?
+        static_cast<double>(state.electronicsCreditCount) / state.electronicsCount * 100 : 0;
+    std::cout << "Total Electronics purchases: " << state.electronicsCount << std::endl;
+    std::cout << "Electronics purchases with Credit Card: " << state.electronicsCreditCount << std::endl;
+    std::cout << "Percentage: " << std::fixed << std::setprecision(4) << percentage << "%" << std::endl;
+
+    Array<WordFreq> sortedWords(wordFrequencies.getSize() > 0 ? wordFrequencies.getSize() : 1);
+    for (const WordCountMap::Entry& e : wordFrequencies) {
+        WordFreq wf;
+        wf.word = String(e.word, e.length);
+        wf.frequency = static_cast<int>(e.count);
+        sortedWords.push_back(std::move(wf));
+    }
+    if (sortedWords.getSize() > 0) mergeSortArray(sortedWords, 0, sortedWords.getSize() - 1);
+    std::cout << "--- First 10 Words Frequency ---" << std::endl;
+    int displayCount = 0;
+    for (int i = sortedWords.getSize() - 1; i >= 0 && displayCount < 10; i--) {
+        if (sortedWords[i].word.size() < 3) continue;
+        std::cout << sortedWords[i].word << ": " << sortedWords[i].frequency << " occurrences" << std::endl;
+        displayCount++;
+    }
+    return 0;
 }
 
 // Note: The sorting and searching functions have been moved to Algorithms.hpp
 
-int main() {
+int main(int argc, char* argv[]) {
+    // --raw cleans transactions.csv/reviews.csv in memory instead of reading the
+    // *Clean.csv files; --write-clean also writes the clean files as a side output;
+    // --incremental only ingests rows appended since the previous --incremental run
+    bool fromRaw = false;
+    bool writeClean = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--raw") == 0) fromRaw = true;
+        else if (strcmp(argv[i], "--write-clean") == 0) writeClean = true;
+        else if (strcmp(argv[i], "--incremental") == 0) return runIncremental();
+    }
+
+    // Field bytes of every loaded record; declared first so it is released
+    // in one go after all containers referring into it are gone
+    Arena transactionArena;
+    Arena reviewArena;
+
     LinkedList<Transaction> transactions;
     LinkedList<Review> reviews;
-    LinkedList<WordFreq> wordFrequencies;
+    WordCountMap wordFrequencies;
     int totalTransactions = 0;
     int electronicsCredit = 0;
     int totalElectronics = 0;
 
-    // Read transactions
-    std::ifstream transFile("transactionsClean.csv");
-    if (!transFile.is_open()) {
-        std::cerr << "Error: Could not open transactionsClean.csv" << std::endl;
-        return 1;
-    }
-    readCSVLine(transFile); // Skip header
-    
-    while (transFile.good()) {
-        auto parts = readCSVLine(transFile);
-        if (parts.getSize() > 0) {
-            processTransaction(parts, transactions, totalTransactions, electronicsCredit, totalElectronics);
+    Array<Transaction> loadedTransactions;
+    Array<Review> loadedReviews;
+    if (fromRaw) {
+        if (!loadRawTransactions(loadedTransactions, transactionArena, writeClean)) return 1;
+        if (!loadRawReviews(loadedReviews, reviewArena, writeClean)) return 1;
+    } else {
+        // Read transactions from the binary cache, or else the CSV
+        // (memory-mapped, parsed in parallel chunks)
+        if (!loadTransactionCache(loadedTransactions, transactionArena) &&
+            parallelLoadCSV("transactionsClean.csv", loadedTransactions, parseTransaction, transactionArena, 0, &std::cout) < 0) {
+            std::cerr << "Error: Could not open transactionsClean.csv" << std::endl;
+            return 1;
+        }
+
+        // Read reviews
+        if (!loadReviewCache(loadedReviews, reviewArena) &&
+            parallelLoadCSV("reviewsClean.csv", loadedReviews, parseReview, reviewArena, 0, &std::cout) < 0) {
+            std::cerr << "Error: Could not open reviewsClean.csv" << std::endl;
+            return 1;
         }
     }
 
-    // Read reviews
-    std::ifstream reviewFile("reviewsClean.csv");
-    if (!reviewFile.is_open()) {
-        std::cerr << "Error: Could not open reviewsClean.csv" << std::endl;
-        return 1;
+    for (int i = 0; i < loadedTransactions.getSize(); i++) {
+        processTransaction(loadedTransactions[i], transactions, totalTransactions, electronicsCredit, totalElectronics);
     }
-    readCSVLine(reviewFile); // Skip header
-    
-    while (reviewFile.good()) {
-        auto parts = readCSVLine(reviewFile);
-        if (parts.getSize() > 0) {
-            processReview(parts, reviews, wordFrequencies);
-        }
+    for (int i = 0; i < loadedReviews.getSize(); i++) {
+        processReview(loadedReviews[i], reviews, wordFrequencies);
     }
 
     // 1. Sort transactions by date using merge sort
@@ -283,7 +492,7 @@ int main() {
         transactionsArr.push_back(*it);
     }
     auto startArrSort = std::chrono::high_resolution_clock::now();
-    mergeSortArray(transactionsArr, 0, transactionsArr.getSize() - 1);
+    mergeSortArrayByKey(transactionsArr, transactionDateKey);
     auto endArrSort = std::chrono::high_resolution_clock::now();
     double arrSortTime = std::chrono::duration_cast<std::chrono::microseconds>(endArrSort - startArrSort).count() / 1e6;
     std::cout << "Merge Sort (Array) time: " << arrSortTime << " seconds" << std::endl;
@@ -313,14 +522,10 @@ int main() {
     std::cout << "Sorting Time: " << sortTime1 << " milliseconds" << std::endl;
 
     // --- ARRAY VERSION for stats ---
-    Array<Transaction> transactionsArray(transactions.getSize());
-    for (auto it = transactions.begin(); it != transactions.end(); ++it) {
-        transactionsArray.push_back(*it);
-    }
-    
-    // Measure sorting time for array
+    // Measure sorting time for array: a date-ordered view of the loaded
+    // rows, so no record is copied or moved
     auto startArraySort = std::chrono::high_resolution_clock::now();
-    mergeSortArray(transactionsArray, 0, transactionsArray.getSize() - 1);
+    SortedView<const Transaction*> byDate = sortedViewByKey(loadedTransactions, transactionDateKey);
     auto endArraySort = std::chrono::high_resolution_clock::now();
     double arraySortTime = std::chrono::duration_cast<std::chrono::microseconds>(endArraySort - startArraySort).count() / 1e6;
 
@@ -341,26 +546,19 @@ int main() {
     std::cout << "Percentage: " << std::fixed << std::setprecision(4) << percentageArray << "%\n";
     std::cout << "Performance Metrics:\n";
     std::cout << "  Sorting time: " << std::fixed << std::setprecision(6) << arraySortTime << " seconds\n";
+    if (byDate.getSize() > 0) {
+        char first[11], last[11];
+        formatDateKey(byDate[0].dateKey, first);
+        formatDateKey(byDate[byDate.getSize() - 1].dateKey, last);
+        std::cout << "  Date range: " << first << " to " << last << "\n";
+    }
 
     // 3. Word Frequency Analysis with Jump Search timing
     std::cout << "\n3. Word Frequency Analysis Performance:" << std::endl;
     
-    // Create a sorted array of word frequencies for easier manipulation
-    Array<WordFreq> sortedWords(wordFrequencies.getSize());
-    for (auto it = wordFrequencies.begin(); it != wordFrequencies.end(); ++it) {
-        sortedWords.push_back(*it);
-    }
-    
-    // Sort the array by frequency in descending order
-    for (int i = 0; i < sortedWords.getSize(); i++) {
-        for (int j = i + 1; j < sortedWords.getSize(); j++) {
-            if (sortedWords[i].frequency < sortedWords[j].frequency) {
-                WordFreq temp = sortedWords[i];
-                sortedWords[i] = sortedWords[j];
-                sortedWords[j] = temp;
-            }
-        }
-    }
+    // Create an array of word frequencies sorted by frequency in descending order
+    Array<WordFreq> sortedWords;
+    sortedWordArray(wordFrequencies, sortedWords);
     
     // Display the top 10 words
     std::cout << "--- First 10 Words Frequency ---" << std::endl;
@@ -373,8 +571,9 @@ int main() {
         displayCount++;
     }
     
-    // Create a larger list for jump search measurement
-    Array<WordFreq> searchArray(10000);
+    // Create a larger list for jump search measurement; its blocks are
+    // filled in place, so growing it never copies the words already added
+    SegmentedArray<WordFreq> searchArray;
     
     // Fill the array with copies of the sorted words to make it larger
     for (int i = 0; i < 100; i++) {
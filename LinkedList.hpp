@@ -4,6 +4,8 @@
 #include <iostream>
 #include <string>
 #include <iterator>
+#include <utility>
+#include "NodePool.hpp"
 
 template<typename T>
 class Node {
@@ -11,14 +13,24 @@ public:
     T data;
     Node* next;
     
-    Node(T value) : data(value), next(nullptr) {}
+    Node(T value) : data(std::move(value)), next(nullptr) {}
 };
 
-template<typename T>
+// Nodes come from a per-list NodePool (pass UsePool = false for plain
+// new/delete), and a tail pointer makes insert O(1).
+template<typename T, bool UsePool = true>
 class LinkedList {
 private:
     Node<T>* head;
+    Node<T>* tail;
     int size;
+    NodePool<Node<T>, UsePool> pool;
+
+    void clear() {
+        pool.releaseAll(head);
+        head = tail = nullptr;
+        size = 0;
+    }
 
 public:
     // Iterator class definition
@@ -64,10 +76,10 @@ public:
     Iterator begin() { return Iterator(head); }
     Iterator end() { return Iterator(nullptr); }
 
-    LinkedList() : head(nullptr), size(0) {}
+    LinkedList() : head(nullptr), tail(nullptr), size(0) {}
     
     // Deep copy constructor
-    LinkedList(const LinkedList& other) : head(nullptr), size(0) {
+    LinkedList(const LinkedList& other) : head(nullptr), tail(nullptr), size(0) {
         Node<T>* current = other.head;
         while (current != nullptr) {
             insert(current->data);
@@ -78,17 +90,10 @@ public:
     // Deep copy assignment operator
     LinkedList& operator=(const LinkedList& other) {
         if (this != &other) {
-            // Clean up current list
-            Node<T>* current = head;
-            while (current != nullptr) {
-                Node<T>* next = current->next;
-                delete current;
-                current = next;
-            }
-            head = nullptr;
-            size = 0;
+            // Clean up current list in one release
+            clear();
             // Copy from other
-            current = other.head;
+            Node<T>* current = other.head;
             while (current != nullptr) {
                 insert(current->data);
                 current = current->next;
@@ -98,32 +103,25 @@ public:
     }
 
     ~LinkedList() {
-        Node<T>* current = head;
-        while (current != nullptr) {
-            Node<T>* next = current->next;
-            delete current;
-            current = next;
-        }
+        clear();
     }
 
     void insert(T value) {
-        Node<T>* newNode = new Node<T>(value);
+        Node<T>* newNode = pool.create(std::move(value));
         if (head == nullptr) {
             head = newNode;
         } else {
-            Node<T>* current = head;
-            while (current->next != nullptr) {
-                current = current->next;
-            }
-            current->next = newNode;
+            tail->next = newNode;
         }
+        tail = newNode;
         size++;
     }
 
     void insertAtBeginning(T value) {
-        Node<T>* newNode = new Node<T>(value);
+        Node<T>* newNode = pool.create(std::move(value));
         newNode->next = head;
         head = newNode;
+        if (tail == nullptr) tail = newNode;
         size++;
     }
 
@@ -133,7 +131,8 @@ public:
         if (head->data == value) {
             Node<T>* temp = head;
             head = head->next;
-            delete temp;
+            if (tail == temp) tail = nullptr;
+            pool.destroy(temp);
             size--;
             return true;
         }
@@ -146,7 +145,8 @@ public:
         if (current->next != nullptr) {
             Node<T>* temp = current->next;
             current->next = temp->next;
-            delete temp;
+            if (tail == temp) tail = current;
+            pool.destroy(temp);
             size--;
             return true;
         }
@@ -169,7 +169,13 @@ public:
     
     int getSize() const { return size; }
     
-    void setHead(Node<T>* newHead) { head = newHead; }
+    // Relinks the list (e.g. after sorting its nodes); the nodes must all
+    // come from this list
+    void setHead(Node<T>* newHead) {
+        head = newHead;
+        tail = newHead;
+        while (tail != nullptr && tail->next != nullptr) tail = tail->next;
+    }
 
     void display() {
         for (auto it = begin(); it != end(); ++it) {
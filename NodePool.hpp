@@ -0,0 +1,134 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Slab allocator for linked-list nodes. Nodes are carved out of chunks that
+// double in size (256 nodes up to 64K), so nodes inserted one after another
+// sit next to each other in memory, and a whole list is freed with one
+// delete per chunk. A node freed on its own goes on a free list and is
+// reused by the next create().
+//
+// NodeT must have a `next` pointer, which releaseAll() follows to run the
+// element destructors; for trivially destructible nodes that walk is skipped
+// and teardown is O(chunks).
+template<typename NodeT, bool Enabled = true>
+class NodePool {
+private:
+    union Slot {
+        Slot* nextFree;
+        alignas(NodeT) unsigned char bytes[sizeof(NodeT)];
+    };
+
+    struct Chunk {
+        Chunk* next;
+        size_t capacity;
+
+        Slot* slots() { return reinterpret_cast<Slot*>(this + 1); }
+    };
+
+    static const size_t FIRST_CHUNK = 256;
+    static const size_t MAX_CHUNK = 64 * 1024;
+
+    Chunk* chunks;      // Newest first
+    size_t used;        // Slots handed out from the newest chunk
+    Slot* freeSlots;
+
+    static_assert(sizeof(Chunk) % alignof(Slot) == 0, "slots must start aligned after the chunk header");
+
+    Slot* takeSlot() {
+        if (freeSlots) {
+            Slot* slot = freeSlots;
+            freeSlots = slot->nextFree;
+            return slot;
+        }
+        if (!chunks || used == chunks->capacity) {
+            size_t capacity = chunks ? chunks->capacity * 2 : FIRST_CHUNK;
+            if (capacity > MAX_CHUNK) capacity = MAX_CHUNK;
+            Chunk* chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + capacity * sizeof(Slot)));
+            chunk->next = chunks;
+            chunk->capacity = capacity;
+            chunks = chunk;
+            used = 0;
+        }
+        return &chunks->slots()[used++];
+    }
+
+public:
+    NodePool() : chunks(nullptr), used(0), freeSlots(nullptr) {}
+
+    ~NodePool() {
+        freeChunks();
+    }
+
+    // Each list owns its pool, so pools are never shared or copied
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // Builds a node in the pool from args (brace-initialised, so plain
+    // aggregates work as well as nodes with constructors)
+    template<typename... Args>
+    NodeT* create(Args&&... args) {
+        Slot* slot = takeSlot();
+        return new (slot->bytes) NodeT{std::forward<Args>(args)...};
+    }
+
+    // Destroys one node and keeps its slot for reuse
+    void destroy(NodeT* node) {
+        node->~NodeT();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->nextFree = freeSlots;
+        freeSlots = slot;
+    }
+
+    // Destroys the list starting at head and frees every chunk at once.
+    // All nodes created from this pool must be reachable from head.
+    void releaseAll(NodeT* head) {
+        if (!std::is_trivially_destructible<NodeT>::value) {
+            while (head != nullptr) {
+                NodeT* next = head->next;
+                head->~NodeT();
+                head = next;
+            }
+        }
+        freeChunks();
+    }
+
+private:
+    void freeChunks() {
+        while (chunks) {
+            Chunk* next = chunks->next;
+            ::operator delete(chunks);
+            chunks = next;
+        }
+        used = 0;
+        freeSlots = nullptr;
+    }
+};
+
+// Pool switched off: plain new/delete per node, for comparison
+template<typename NodeT>
+class NodePool<NodeT, false> {
+public:
+    template<typename... Args>
+    NodeT* create(Args&&... args) {
+        return new NodeT{std::forward<Args>(args)...};
+    }
+
+    void destroy(NodeT* node) {
+        delete node;
+    }
+
+    void releaseAll(NodeT* head) {
+        while (head != nullptr) {
+            NodeT* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+};
+
+#endif // NODE_POOL_HPP
@@ -0,0 +1,144 @@
+#ifndef NUMBER_PARSE_HPP
+#define NUMBER_PARSE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Allocation-free number parsing for the CSV fields. Each routine validates
+// and converts in a single pass over the bytes and reports problems through
+// a status code, so nothing throws and no temporary strings are built.
+
+enum NumberStatus {
+    NUM_OK,
+    NUM_EMPTY,      // No characters at all
+    NUM_INVALID,    // Not a plain decimal number
+    NUM_OVERFLOW    // Does not fit the target type
+};
+
+// Largest price accepted, in cents; leaves headroom for summing many prices
+const int64_t MAX_PRICE_CENTS = INT64_MAX / 1024;
+
+// Parses "[+-]digits[.digits]" into whole cents. A third fractional digit
+// rounds half away from zero; digits after that are checked but ignored.
+// Leading and trailing spaces are not allowed, matching the clean files.
+inline NumberStatus parsePriceCents(const char* p, size_t len, int64_t& cents) {
+    cents = 0;
+    if (len == 0) return NUM_EMPTY;
+    const char* end = p + len;
+
+    bool negative = false;
+    if (*p == '+' || *p == '-') {
+        negative = *p == '-';
+        if (++p == end) return NUM_INVALID;
+    }
+
+    int64_t value = 0;
+    int digits = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; p++, digits++) {
+        value = value * 10 + (*p - '0');
+        if (value > MAX_PRICE_CENTS / 100) return NUM_OVERFLOW;
+    }
+    value *= 100;
+
+    if (p < end && *p == '.') {
+        p++;
+        int fraction = 0;
+        for (int64_t scale = 10; p < end && *p >= '0' && *p <= '9'; p++, fraction++) {
+            if (fraction < 2) {
+                value += (*p - '0') * scale;
+                scale /= 10;
+            } else if (fraction == 2 && *p >= '5') {
+                value++;
+            }
+        }
+        digits += fraction;
+    }
+
+    if (p != end || digits == 0) return NUM_INVALID;
+    cents = negative ? -value : value;
+    return NUM_OK;
+}
+
+// Parses an unsigned decimal rating into one byte ("Invalid Rating" and
+// values above 255 are rejected; range checks are up to the caller)
+inline NumberStatus parseRating(const char* p, size_t len, uint8_t& rating) {
+    rating = 0;
+    if (len == 0) return NUM_EMPTY;
+    unsigned int value = 0;
+    for (const char* end = p + len; p < end; p++) {
+        if (*p < '0' || *p > '9') return NUM_INVALID;
+        value = value * 10 + (*p - '0');
+        if (value > 255) return NUM_OVERFLOW;
+    }
+    rating = static_cast<uint8_t>(value);
+    return NUM_OK;
+}
+
+// Parses a "DD/MM/YYYY" date into a YYYYMMDD key, so that comparing keys as
+// integers orders dates chronologically. Month must be 1-12 and day 1-31.
+inline NumberStatus parseDateKey(const char* p, size_t len, uint32_t& key) {
+    key = 0;
+    if (len == 0) return NUM_EMPTY;
+    if (len != 10 || p[2] != '/' || p[5] != '/') return NUM_INVALID;
+    static const int digitAt[8] = {0, 1, 3, 4, 6, 7, 8, 9};
+    uint32_t d[8];
+    for (int i = 0; i < 8; i++) {
+        d[i] = static_cast<uint32_t>(static_cast<unsigned char>(p[digitAt[i]]) - '0');
+        if (d[i] > 9) return NUM_INVALID;
+    }
+    uint32_t day = d[0] * 10 + d[1];
+    uint32_t month = d[2] * 10 + d[3];
+    uint32_t year = d[4] * 1000 + d[5] * 100 + d[6] * 10 + d[7];
+    if (month < 1 || month > 12 || day < 1 || day > 31) return NUM_INVALID;
+    key = year * 10000 + month * 100 + day;
+    return NUM_OK;
+}
+
+// YYYYMMDD back to "DD/MM/YYYY"; out must hold 11 bytes
+inline void formatDateKey(uint32_t key, char* out) {
+    uint32_t year = key / 10000, month = key / 100 % 100, day = key % 100;
+    out[0] = static_cast<char>('0' + day / 10);
+    out[1] = static_cast<char>('0' + day % 10);
+    out[2] = '/';
+    out[3] = static_cast<char>('0' + month / 10);
+    out[4] = static_cast<char>('0' + month % 10);
+    out[5] = '/';
+    out[6] = static_cast<char>('0' + year / 1000);
+    out[7] = static_cast<char>('0' + year / 100 % 10);
+    out[8] = static_cast<char>('0' + year / 10 % 10);
+    out[9] = static_cast<char>('0' + year % 10);
+    out[10] = '\0';
+}
+
+// Short description of a status for error messages
+inline const char* numberStatusText(NumberStatus status) {
+    switch (status) {
+    case NUM_OK: return "OK";
+    case NUM_EMPTY: return "Empty number";
+    case NUM_OVERFLOW: return "Number out of range";
+    default: return "Invalid number format";
+    }
+}
+
+// Writes cents as "units.cc"; out must hold 24 bytes. Returns the length.
+inline int formatCents(int64_t cents, char* out) {
+    char digits[24];
+    int n = 0;
+    bool negative = cents < 0;
+    uint64_t value = negative ? 0 - static_cast<uint64_t>(cents) : static_cast<uint64_t>(cents);
+    do {
+        digits[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0 || n < 3);
+
+    int len = 0;
+    if (negative) out[len++] = '-';
+    while (n > 2) out[len++] = digits[--n];
+    out[len++] = '.';
+    out[len++] = digits[1];
+    out[len++] = digits[0];
+    out[len] = '\0';
+    return len;
+}
+
+#endif // NUMBER_PARSE_HPP
@@ -0,0 +1,136 @@
+#ifndef PARALLEL_LOADER_HPP
+#define PARALLEL_LOADER_HPP
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include "Array.hpp"
+#include "SegmentedArray.hpp"
+#include "CSVReader.hpp"
+#include "Arena.hpp"
+
+// Ranges smaller than this are not worth a thread of their own
+const size_t MIN_BYTES_PER_THREAD = 1 << 20;
+
+// Throughput numbers for one worker
+struct LoadStats {
+    size_t bytes;
+    int rows;
+    double seconds;
+
+    LoadStats() : bytes(0), rows(0), seconds(0.0) {}
+};
+
+// Picks the worker count for a range of the given size
+inline size_t chooseThreadCount(size_t bytes, int requested) {
+    size_t threads = requested > 0 ? static_cast<size_t>(requested) : std::thread::hardware_concurrency();
+    if (threads < 1) threads = 1;
+    size_t maxUseful = bytes / MIN_BYTES_PER_THREAD + 1;
+    if (requested <= 0 && threads > maxUseful) threads = maxUseful;
+    return threads;
+}
+
+// Cuts [begin, end) into parts ranges that each start right after a newline.
+// bounds must hold parts + 1 pointers; empty ranges are possible on tiny inputs.
+inline void splitNewlineAligned(const char* begin, const char* end, size_t parts, const char** bounds) {
+    size_t total = end > begin ? static_cast<size_t>(end - begin) : 0;
+    bounds[0] = begin;
+    for (size_t i = 1; i < parts; i++) {
+        const char* cut = begin + total / parts * i;
+        if (cut < bounds[i - 1]) cut = bounds[i - 1];
+        const char* nl = cut < end ? static_cast<const char*>(memchr(cut, '\n', static_cast<size_t>(end - cut))) : nullptr;
+        bounds[i] = nl ? nl + 1 : end;
+    }
+    bounds[parts] = end;
+}
+
+// Loads a CSV file with one worker thread per newline-aligned byte range.
+// Ranges are cut at raw newlines, which is only safe if no quoted field
+// spans lines, so a file containing any quote is loaded by a single worker.
+// The clean files have no quotes and no line breaks inside fields (the
+// review cleaner flattens them), so they keep every worker.
+// parseRow(const CSVRow&, T&, Arena&) returns false to drop a row. Each
+// worker fills its own SegmentedArray (rows are never relocated while it
+// grows) and copies field bytes into its own Arena; the results are moved
+// into out in file order, freeing each chunk's blocks as they empty, and the
+// arenas are handed over to arena, which must outlive the records.
+// maxFields is passed to each worker's CSVRange::setMaxFields, so fields
+// past the maxFields-th are folded into the last one.
+// Returns the number of rows loaded, or -1 if the file cannot be opened.
+template<typename T, typename ParseFn>
+int parallelLoadCSV(const char* path, Array<T>& out, ParseFn parseRow, Arena& arena,
+                    int threadCount = 0, std::ostream* report = nullptr, int maxFields = CSV_MAX_FIELDS) {
+    MappedFile file(path);
+    if (!file.isOpen()) return -1;
+
+    CSVRange header(file.begin(), file.end());
+    header.skipLine();
+    const char* dataStart = header.position();
+    size_t dataBytes = file.end() > dataStart ? static_cast<size_t>(file.end() - dataStart) : 0;
+
+    size_t threads = chooseThreadCount(dataBytes, threadCount);
+    if (threads > 1 && memchr(dataStart, '"', dataBytes)) threads = 1;
+    std::unique_ptr<const char*[]> bounds(new const char*[threads + 1]);
+    splitNewlineAligned(dataStart, file.end(), threads, bounds.get());
+
+    std::unique_ptr<SegmentedArray<T>[]> chunks(new SegmentedArray<T>[threads]);
+    std::unique_ptr<LoadStats[]> stats(new LoadStats[threads]);
+    std::unique_ptr<Arena[]> arenas(new Arena[threads]);
+
+    auto worker = [&](size_t id) {
+        auto start = std::chrono::high_resolution_clock::now();
+        CSVRange range(bounds[id], bounds[id + 1]);
+        range.setMaxFields(maxFields);
+        CSVRow row;
+        T record;
+        while (range.nextRow(row)) {
+            if (parseRow(row, record, arenas[id])) {
+                chunks[id].push_back(std::move(record));
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        stats[id].bytes = static_cast<size_t>(bounds[id + 1] - bounds[id]);  // Bounds never decrease
+        stats[id].rows = chunks[id].getSize();
+        stats[id].seconds = std::chrono::duration<double>(end - start).count();
+    };
+
+    if (threads == 1) {
+        worker(0);
+    } else {
+        std::unique_ptr<std::thread[]> pool(new std::thread[threads]);
+        for (size_t i = 0; i < threads; i++) pool[i] = std::thread(worker, i);
+        for (size_t i = 0; i < threads; i++) pool[i].join();
+    }
+
+    // Concatenate in original file order, sizing out once
+    int total = out.getSize();
+    for (size_t i = 0; i < threads; i++) total += chunks[i].getSize();
+    out.reserve(total);
+    int loaded = 0;
+    for (size_t i = 0; i < threads; i++) {
+        loaded += chunks[i].getSize();
+        chunks[i].moveTo(out);
+        arena.absorb(arenas[i]);
+    }
+
+    if (report) {
+        std::ios::fmtflags flags = report->flags();
+        std::streamsize precision = report->precision();
+        *report << "Loaded " << path << " with " << threads << " thread(s):" << std::endl;
+        for (size_t i = 0; i < threads; i++) {
+            double mb = static_cast<double>(stats[i].bytes) / (1024.0 * 1024.0);
+            double rate = stats[i].seconds > 0 ? mb / stats[i].seconds : 0.0;
+            *report << "  Thread " << i << ": " << stats[i].rows << " rows, "
+                    << std::fixed << std::setprecision(2) << mb << " MB, "
+                    << rate << " MB/s" << std::endl;
+        }
+        report->flags(flags);
+        report->precision(precision);
+    }
+    return loaded;
+}
+
+#endif // PARALLEL_LOADER_HPP
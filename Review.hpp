@@ -2,14 +2,16 @@
 #define REVIEW_HPP
 
 #include "CustomString.hpp"
+#include "SymbolTable.hpp"
 
 struct Review {
-    MyString productID, customerID, reviewText;
+    Symbol productID, customerID; // Interned symbols
+    MyString reviewText;
     int rating;
     
-    Review() : rating(0) {}
+    Review() : productID(NO_SYMBOL), customerID(NO_SYMBOL), rating(0) {}
     
-    Review(const MyString& pid, const MyString& cid, const MyString& text, int r)
+    Review(Symbol pid, Symbol cid, const MyString& text, int r)
         : productID(pid), customerID(cid), reviewText(text), rating(r) {}
 };
 
@@ -9,25 +9,41 @@
  #include <string>          
  #include <cctype>          
  #include "LinkedList.hpp"   
+ #include "UnrolledList.hpp"
+ #include "TransactionTable.hpp"
  #include "Array.hpp"        
+ #include "SegmentedArray.hpp"
+ #include "IndexSort.hpp"
  #include "CustomString.hpp"   
  #include "StringUtils.hpp" 
+ #include "ParallelLoader.hpp"
+ #include "CleanPipeline.hpp"
+ #include "ColumnarCache.hpp"
+ #include "NumberParse.hpp"
+ #include "Arena.hpp"
+ #include "SymbolTable.hpp"
+ #include "WordTokenizer.hpp"
+ #include "WordCountMap.hpp"
  
  
  using StringArray = Array<String>;
  
- // Stores transaction data
+ // Stores transaction data (IDs, category and payment method are interned symbols)
  struct Transaction {
-     String customerId; String productId; double price; String date; String category; String paymentMethod;
-     Transaction() : price(0.0) {}
-     bool operator>(const Transaction& other) const { return date > other.date; }
-     bool operator<(const Transaction& other) const { return date < other.date; }
+     Symbol customerId; Symbol productId; int64_t priceCents; String date; uint32_t dateKey; Symbol category; Symbol paymentMethod;
+     Transaction() : customerId(NO_SYMBOL), productId(NO_SYMBOL), priceCents(0), dateKey(0), category(NO_SYMBOL), paymentMethod(NO_SYMBOL) {}
+     // Dates compare as YYYYMMDD integers
+     bool operator>(const Transaction& other) const { return dateKey > other.dateKey; }
+     bool operator<(const Transaction& other) const { return dateKey < other.dateKey; }
  };
  
+ // Sort key of a transaction, for the key/index heap sorts
+ inline uint32_t transactionDateKey(const Transaction& t) { return t.dateKey; }
+ 
  // Stores review data
  struct Review {
-     String productId; String customerId; int rating; String reviewText;
-     Review() : rating(0) {}
+     Symbol productId; Symbol customerId; int rating; String reviewText;
+     Review() : productId(NO_SYMBOL), customerId(NO_SYMBOL), rating(0) {}
      bool operator>(const Review& other) const { return rating > other.rating; }
      bool operator<(const Review& other) const { return rating < other.rating; }
  };
@@ -39,112 +55,176 @@
      WordFreq(const String& w, int c) : word(w), count(c) {}
      bool operator>(const WordFreq& other) const { if (count != other.count) return count > other.count; return word < other.word; }
      bool operator<(const WordFreq& other) const { if (count != other.count) return count < other.count; return word > other.word; }
-     bool operator==(const WordFreq& other) const { return strcmp(word.c_str(), other.word.c_str()) == 0; }
+     bool operator==(const WordFreq& other) const { return word == other.word; }
  };
  
  
  // --- Utility Functions ---
  
- // Safely converts String to double.
- double safeStod(const String& str) {
-     if (str.size() == 0 || (str.size() > 0 && std::isspace(str.c_str()[0]))) return 0.0;
-     try {
-         return std::stod(str.c_str());
-     } catch (const std::invalid_argument&) { return 0.0; }
-       catch (const std::out_of_range&) { return 0.0; }
+ // Reads a price field as cents (0 if invalid).
+ int64_t readPriceCents(const FieldView& field) {
+     int64_t cents; return parsePriceCents(field.ptr, field.len, cents) == NUM_OK ? cents : 0;
+ }
+ 
+ // Reads a date field as a YYYYMMDD key (0 if invalid).
+ uint32_t readDateKey(const FieldView& field) {
+     uint32_t key; return parseDateKey(field.ptr, field.len, key) == NUM_OK ? key : 0;
+ }
+ 
+ // Reads a rating field (0 if invalid).
+ int readRating(const FieldView& field) {
+     uint8_t rating; return parseRating(field.ptr, field.len, rating) == NUM_OK ? rating : 0;
+ }
+ 
+ // Splits "CustomerID|ProductID" field view.
+ void splitCustomerProduct(const FieldView& combined, Symbol& customerId, Symbol& productId) {
+     long pipe = combined.find('|');
+     if (pipe >= 0) { customerId = intern(combined.substr(0, pipe)); productId = intern(combined.substr(pipe + 1, combined.size())); }
+     else { customerId = intern(combined); productId = intern(""); }
  }
  
- // Safely converts String to int.
- int safeStoi(const String& str) {
-     if (str.size() == 0 || (str.size() > 0 && std::isspace(str.c_str()[0]))) return 0;
-     try {
-         return std::stoi(str.c_str());
-     } catch (const std::invalid_argument&) { return 0; }
-       catch (const std::out_of_range&) { return 0; }
+ // Counts a single word (already lowercased by the tokenizer).
+ void processWord(const WordToken& word, WordCountMap& wordCounts) {
+     if (!word.hasLetter) return;
+     wordCounts.increment(word.ptr, word.len);
  }
  
- // Splits "CustomerID|ProductID" string.
- void splitCustomerProduct(const String& combined, String& customerId, String& productId) {
-     const char* str = combined.c_str(); String temp = ""; bool foundPipe = false; size_t len = strlen(str);
-     for (size_t i = 0; i < len; i++) {
-         if (str[i] == '|') { customerId = temp; temp = ""; foundPipe = true; }
-         else { char c[2] = {str[i], '\0'}; temp = temp + String(c); }
+ // Parses a transaction row (runs on loader threads).
+ bool parseTransaction(const CSVRow& parts, Transaction& t, Arena& arena) {
+     if (parts.getSize() < 5) return false;
+     splitCustomerProduct(parts[0], t.customerId, t.productId);
+     t.category = intern(parts[1]); t.priceCents = readPriceCents(parts[2]); t.date = toString(parts[3], arena); t.dateKey = readDateKey(parts[3]); t.paymentMethod = intern(parts[4]);
+     return true;
+ }
+ 
+ // Processes a parsed transaction.
+ void processTransaction(const Transaction& t, LinkedList<Transaction>& transactions,
+                         int& electronicsCreditCard, int& electronicsTotal, int64_t& electronicsCents) {
+     transactions.insert(t);
+     static const Symbol elec = intern("Electronics"); static const Symbol cc = intern("Credit Card");
+     if (t.category == elec) {
+         electronicsTotal++; electronicsCents += t.priceCents;
+         if (t.paymentMethod == cc) { electronicsCreditCard++; }
      }
-     if (foundPipe) { productId = temp; }
-     else { customerId = combined; productId = String(""); }
  }
  
- // Processes a single word for frequency counting.
- void processWord(String& word, LinkedList<WordFreq>& wordFrequencies) {
-     if (word.size() == 0) return;
-     word.toLower();
-     bool hasLetter = false; const char* str = word.c_str(); size_t len = strlen(str);
-     for (size_t i = 0; i < len; i++) { if (isalpha(static_cast<unsigned char>(str[i]))) { hasLetter = true; break; } }
-     if (!hasLetter) return;
-     bool found = false;
-     for (auto it = wordFrequencies.begin(); it != wordFrequencies.end(); ++it) {
-         if (strcmp(it->word.c_str(), word.c_str()) == 0) { it->count++; found = true; break; }
+ // Parses a review row (runs on loader threads).
+ bool parseReview(const CSVRow& parts, Review& r, Arena& arena) {
+     if (parts.getSize() < 4) return false;
+     r.productId = intern(parts[0]); r.customerId = intern(parts[1]);
+     r.rating = readRating(parts[2]); r.reviewText = toString(parts[3], arena);
+     return true;
+ }
+ 
+ // Pipeline mode: cleans transactions.csv in memory, optionally writing transactionsClean.csv.
+ bool loadRawTransactions(Array<Transaction>& out, Arena& arena, bool writeClean) {
+     CSVReader rawFile("transactions.csv");
+     if (!rawFile.isOpen()) { std::cerr << "Error opening transactions.csv" << std::endl; return false; }
+     std::ofstream cleanFile; if (writeClean) cleanFile.open("transactionsClean.csv");
+     SegmentedArray<Transaction> rows; // Row count unknown until the end; blocks never relocate
+     runTransactionPipeline(rawFile, [&](const CleanTransaction& c) {
+         Transaction t; t.customerId = intern(c.customerID); t.productId = intern(c.product);
+         t.category = intern(c.category); t.priceCents = c.priceCents; t.date = toString(c.date.data(), c.date.size(), arena); t.dateKey = c.dateKey;
+         t.paymentMethod = intern(c.paymentMethod);
+         rows.push_back(std::move(t));
+     }, writeClean ? &cleanFile : nullptr, nullptr);
+     rows.moveTo(out);
+     return true;
+ }
+ 
+ // Pipeline mode: cleans reviews.csv in memory, optionally writing reviewsClean.csv.
+ bool loadRawReviews(Array<Review>& out, Arena& arena, bool writeClean) {
+     CSVReader rawFile("reviews.csv");
+     if (!rawFile.isOpen()) { std::cerr << "Error opening reviews.csv" << std::endl; return false; }
+     std::ofstream cleanFile; if (writeClean) cleanFile.open("reviewsClean.csv");
+     SegmentedArray<Review> rows; // Row count unknown until the end; blocks never relocate
+     runReviewPipeline(rawFile, [&](const CleanReview& c) {
+         Review r; r.productId = intern(c.productID); r.customerId = intern(c.customerID);
+         r.rating = c.rating; r.reviewText = toString(c.reviewText.data(), c.reviewText.size(), arena);
+         rows.push_back(std::move(r));
+     }, writeClean ? &cleanFile : nullptr, nullptr);
+     rows.moveTo(out);
+     return true;
+ }
+ 
+ // Cache path: fills transactions straight from the binary columns (false if missing or stale).
+ bool loadTransactionCache(Array<Transaction>& out, Arena& arena) {
+     TransactionCache cache;
+     if (!cache.open("transactionsClean.bin", "transactionsClean.csv")) return false;
+     char date[11];
+     for (int i = 0; i < cache.getSize(); i++) {
+         Transaction t; t.customerId = intern(cache.customerID(i)); t.productId = intern(cache.product(i));
+         t.category = intern(cache.category(i)); t.priceCents = cache.priceCents(i);
+         formatDateKey(cache.dateKey(i), date); t.date = toString(date, 10, arena); t.dateKey = cache.dateKey(i); t.paymentMethod = intern(cache.paymentMethod(i));
+         out.push_back(std::move(t));
      }
-     if (!found) { wordFrequencies.insert(WordFreq(word, 1)); }
+     std::cout << "Using binary cache transactionsClean.bin" << std::endl;
+     return true;
  }
  
- // Processes a transaction data line.
- void processTransaction(const StringArray& parts, LinkedList<Transaction>& transactions,
-                         int& electronicsCreditCard, int& electronicsTotal) {
-     if (parts.getSize() >= 5) {
-         Transaction t; String tempCustId, tempProdId;
-         splitCustomerProduct(parts[0], tempCustId, tempProdId);
-         t.customerId = tempCustId; t.productId = tempProdId;
-         t.category = parts[1]; t.price = safeStod(parts[2]); t.date = parts[3]; t.paymentMethod = parts[4];
-         transactions.insert(t);
-         String elec("Electronics"); String cc("Credit Card");
-         if (strcmp(t.category.c_str(), elec.c_str()) == 0) {
-             electronicsTotal++;
-             if (strcmp(t.paymentMethod.c_str(), cc.c_str()) == 0) { electronicsCreditCard++; }
-         }
+ // Cache path: fills reviews straight from the binary columns (false if missing or stale).
+ bool loadReviewCache(Array<Review>& out, Arena& arena) {
+     ReviewCache cache;
+     if (!cache.open("reviewsClean.bin", "reviewsClean.csv")) return false;
+     for (int i = 0; i < cache.getSize(); i++) {
+         Review r; r.productId = intern(cache.productID(i)); r.customerId = intern(cache.customerID(i));
+         r.rating = cache.rating(i); r.reviewText = toString(cache.reviewText(i), arena);
+         out.push_back(std::move(r));
      }
+     std::cout << "Using binary cache reviewsClean.bin" << std::endl;
+     return true;
  }
  
- // Processes a review data line.
- void processReview(const StringArray& parts, LinkedList<Review>& reviews,
-                    LinkedList<WordFreq>& wordFrequencies) {
-     if (parts.getSize() >= 4) {
-         Review r; r.productId = parts[0]; r.customerId = parts[1];
-         r.rating = safeStoi(parts[2]); r.reviewText = parts[3];
-         reviews.insert(r);
-         if (r.rating == 1) {
-             String currentWord = ""; const char* cstr = r.reviewText.c_str(); size_t len = strlen(cstr);
-             for (size_t i = 0; i < len; i++) {
-                 if (isspace(static_cast<unsigned char>(cstr[i])) || ispunct(static_cast<unsigned char>(cstr[i]))) {
-                     if (currentWord.size() > 0) { processWord(currentWord, wordFrequencies); currentWord = ""; }
-                 } else if (isalnum(static_cast<unsigned char>(cstr[i]))) {
-                     char c[2] = {cstr[i], '\0'}; currentWord = currentWord + String(c);
-                 }
-             }
-              if (currentWord.size() > 0) { processWord(currentWord, wordFrequencies); }
-         }
+ // Processes a parsed review.
+ void processReview(const Review& r, LinkedList<Review>& reviews,
+                    WordCountMap& wordCounts) {
+     reviews.insert(r);
+     if (r.rating == 1) {
+         WordTokenizer tokenizer(r.reviewText.c_str(), r.reviewText.size()); WordToken word;
+         while (tokenizer.next(word)) { processWord(word, wordCounts); }
      }
  }
- // Heapify helper for Heap Sort.
+ // Heapify helper for Heap Sort (raw element pointer, so the loop is unchecked).
  template <typename T>
- void heapify(Array<T>& arr, int n, int i) {
+ void heapify(T* arr, int n, int i) {
      int largest = i;
      int left = 2 * i + 1;
      int right = 2 * i + 2;
      if (left < n && arr[left] > arr[largest]) largest = left;
      if (right < n && arr[right] > arr[largest]) largest = right;
      if (largest != i) {
-         T temp = arr[i]; arr[i] = arr[largest]; arr[largest] = temp;
+         std::swap(arr[i], arr[largest]);
          heapify(arr, n, largest);
      }
  }
  
  // Heap Sort for Array (ascending).
  template <typename T>
- void heapSortArray(Array<T>& arr) {
-     int n = arr.getSize();
+ void heapSortArray(Array<T>& array) {
+     T* arr = array.data(); int n = array.getSize();
      for (int i = n / 2 - 1; i >= 0; i--) { heapify(arr, n, i); }
-     for (int i = n - 1; i > 0; i--) { T temp = arr[0]; arr[0] = arr[i]; arr[i] = temp; heapify(arr, i, 0); }
+     for (int i = n - 1; i > 0; i--) { std::swap(arr[0], arr[i]); heapify(arr, i, 0); }
+ }
+ 
+ // Heap Sort by key (ascending): heap-sorts (key, index) pairs, then moves each element once.
+ template <typename T, typename KeyFn>
+ void heapSortArrayByKey(Array<T>& array, KeyFn keyOf) {
+     auto pairs = makeKeyIndex(array.data(), array.getSize(), keyOf);
+     heapSortArray(pairs);
+     Array<int> order = orderOf(pairs); applyOrder(array.data(), order);
+ }
+ 
+ // Heap Sort of a LinkedList by key: heap-sorts (key, index) pairs and relinks the nodes, so no element is moved.
+ template <typename T, typename KeyFn>
+ void heapSortLinkedListByKey(LinkedList<T>& list, KeyFn keyOf) {
+     int n = list.getSize(); if (n < 2) return;
+     Array<Node<T>*> nodes(n);
+     for (Node<T>* current = list.getHead(); current != nullptr; current = current->next) { nodes.push_back(current); }
+     auto pairs = makeKeyIndex(nodes.data(), n, [&](const Node<T>* node) { return keyOf(node->data); });
+     heapSortArray(pairs);
+     for (int i = 0; i + 1 < n; i++) { nodes[pairs[i].index]->next = nodes[pairs[i + 1].index]; }
+     nodes[pairs[n - 1].index]->next = nullptr;
+     list.setHead(nodes[pairs[0].index]);
  }
  
  // Converts LinkedList to Array.
@@ -156,12 +236,12 @@
      return arr;
  }
  
- // Updates LinkedList node data from Array.
+ // Updates LinkedList node data from Array, moving the elements out of it.
  template <typename T>
- void updateLinkedListFromArray(LinkedList<T>& list, const Array<T>& arr) {
+ void updateLinkedListFromArray(LinkedList<T>& list, Array<T>& arr) {
      if (list.getSize() != arr.getSize()) throw std::runtime_error("List/Array size mismatch");
      Node<T>* current = list.getHead(); int i = 0;
-     while (current != nullptr && i < arr.getSize()) { current->data = arr[i]; current = current->next; i++; }
+     while (current != nullptr && i < arr.getSize()) { current->data = std::move(arr[i]); current = current->next; i++; }
  }
  
  // Sorts LinkedList via array conversion using Heap Sort.
@@ -192,72 +272,60 @@
  
  
  // ========================== Main Program Execution ==========================
- int main() {
+ int main(int argc, char* argv[]) {
+ 
+     // --raw cleans transactions.csv/reviews.csv in memory instead of reading the
+     // *Clean.csv files; --write-clean also writes the clean files as a side output
+     bool fromRaw = false;
+     bool writeClean = false;
+     for (int i = 1; i < argc; ++i) {
+         if (strcmp(argv[i], "--raw") == 0) fromRaw = true;
+         else if (strcmp(argv[i], "--write-clean") == 0) writeClean = true;
+     }
      
+     // Owns the field bytes of all loaded records; declared before the
+     // containers so it is released after them, in one go
+     Arena transactionArena;
+     Arena reviewArena;
+
      LinkedList<Transaction> transactionList; 
      LinkedList<Review> reviewList;           
-     LinkedList<WordFreq> wordFrequencies;  
+     WordCountMap wordCounts; // Counted in a hash map; copied into a list and an array for the Q3 sorts
  
      int electronicsTotalCount = 0;
      int electronicsCreditCardCount = 0;
+     int64_t electronicsRevenueCents = 0; // Exact integer sum, no floating-point drift
  
      // --- Load Data ---
+     // Clean files are memory-mapped and parsed in parallel newline-aligned chunks
      std::cout << "Loading data..." << std::endl;
-     std::ifstream transFile("transactionsClean.csv"); 
-     std::ifstream reviewFile("reviewsClean.csv");   
- 
-     // Check if files opened successfully
-     if (!transFile.is_open()) {
-         std::cerr << "Error opening transactionsClean.csv" << std::endl;
-         return 1; 
-     }
-     if (!reviewFile.is_open()) {
-         std::cerr << "Error opening reviewsClean.csv" << std::endl;
-         return 1; 
+     Array<Transaction> loadedTransactions;
+     Array<Review> loadedReviews;
+     if (fromRaw && (!loadRawTransactions(loadedTransactions, transactionArena, writeClean) || !loadRawReviews(loadedReviews, reviewArena, writeClean))) {
+         return 1;
      }
  
-     std::string headerLine; 
- 
      // --- Load Transactions ---
-     // Read and discard the first (header) line
-     if (!std::getline(transFile, headerLine)) {
-         std::cerr << "Error reading header from transactionsClean.csv or file is empty." << std::endl;
-         transFile.close();
-         reviewFile.close();
-         return 1;
+     if (!fromRaw && !loadTransactionCache(loadedTransactions, transactionArena) && parallelLoadCSV("transactionsClean.csv", loadedTransactions, parseTransaction, transactionArena, 0, &std::cout) < 0) {
+         std::cerr << "Error opening transactionsClean.csv" << std::endl;
+         return 1; 
      }
- 
-     // Loop through the rest of the transaction file line by line
-     while (transFile.good() && !transFile.eof()) {
-          StringArray parts = readCSVLine(transFile); 
-          if (parts.empty() && transFile.eof()) break;
-          if (parts.empty()) continue;
-          processTransaction(parts, transactionList, electronicsCreditCardCount, electronicsTotalCount);
+     for (int i = 0; i < loadedTransactions.getSize(); ++i) {
+          processTransaction(loadedTransactions[i], transactionList, electronicsCreditCardCount, electronicsTotalCount, electronicsRevenueCents);
      }
-     transFile.close(); 
      std::cout << "Loaded " << transactionList.getSize() << " transactions." << std::endl;
  
  
      // --- Load Reviews ---
-     // Read and discard the first (header) line
-      if (!std::getline(reviewFile, headerLine)) {
-         std::cerr << "Error reading header from reviewsClean.csv or file is empty." << std::endl;
-         reviewFile.close();
-         return 1;
-      }
- 
-     // Loop through the rest of the review file line by line
-     while (reviewFile.good() && !reviewFile.eof()) {
-          StringArray parts = readCSVLine(reviewFile); 
-          
-           if (parts.empty() && reviewFile.eof()) break;
-          if (parts.empty()) continue;
-          
-          processReview(parts, reviewList, wordFrequencies);
-      }
-     reviewFile.close();
+     if (!fromRaw && !loadReviewCache(loadedReviews, reviewArena) && parallelLoadCSV("reviewsClean.csv", loadedReviews, parseReview, reviewArena, 0, &std::cout) < 0) {
+         std::cerr << "Error opening reviewsClean.csv" << std::endl;
+         return 1; 
+     }
+     for (int i = 0; i < loadedReviews.getSize(); ++i) {
+          processReview(loadedReviews[i], reviewList, wordCounts);
+     }
      std::cout << "Loaded " << reviewList.getSize() << " reviews." << std::endl;
-     std::cout << "Processed " << wordFrequencies.getSize() << " unique words from 1-star reviews." << std::endl;
+     std::cout << "Processed " << wordCounts.getSize() << " unique words from 1-star reviews." << std::endl;
  
  
      // --- Data Analysis ---
@@ -273,13 +341,13 @@
  
      // Time sorting the LinkedList (via array conversion method)
      auto startListSort = std::chrono::high_resolution_clock::now();
-     heapSortLinkedList(transactionList); // Sorts the original list
+     heapSortLinkedListByKey(transactionList, transactionDateKey); // Sorts the original list by relinking
      auto endListSort = std::chrono::high_resolution_clock::now();
      std::chrono::duration<double, std::milli> listSortTime = endListSort - startListSort;
  
      // Time sorting the Array directly
      auto startArraySort = std::chrono::high_resolution_clock::now();
-     heapSortArray(transactionArray); // Sorts the array copy
+     heapSortArrayByKey(transactionArray, transactionDateKey); // Sorts the array copy
      auto endArraySort = std::chrono::high_resolution_clock::now();
      std::chrono::duration<double, std::milli> arraySortTime = endArraySort - startArraySort;
  
@@ -294,11 +362,11 @@
          const Transaction& t = transactionArray[i];
          // Print selected fields for readability
          std::cout << "  Date: " << t.date.c_str()
-                   << ", Cat: " << t.category.c_str()
-                   << ", Cust: " << t.customerId.c_str()
-                   << ", Prod: " << t.productId.c_str()
-                   << ", Price: " << std::fixed << std::setprecision(2) << t.price // Format price
-                   << ", Payment: " << t.paymentMethod.c_str()
+                   << ", Cat: " << symbolName(t.category)
+                   << ", Cust: " << symbolName(t.customerId)
+                   << ", Prod: " << symbolName(t.productId)
+                   << ", Price: " << t.priceCents / 100 << "." << std::setw(2) << std::setfill('0') << t.priceCents % 100 << std::setfill(' ') // Format price
+                   << ", Payment: " << symbolName(t.paymentMethod)
                    << std::endl;
      }
      std::cout << "--- End of Sorted Transactions ---" << std::endl;*/
@@ -309,17 +377,20 @@
  
      // --- Q2: Electronics Purchases Percentage (Linear Search/Filter) ---
      std::cout << "\n--- Q2: Electronics Purchases with Credit Card ---" << std::endl;
-     String electronicsCategory("Electronics"); // Target category string
-     String creditCardPayment("Credit Card"); // Target payment method string
+     // Targets are looked up, not interned: a value no row has never matches
+     Symbol electronicsCategory = globalSymbols().find("Electronics");
+     Symbol creditCardPayment = globalSymbols().find("Credit Card");
      const int Q2_ITERATIONS = 100; // Number of repetitions for timing average
+     // Matches are counted so the timed loops cannot be optimised away
+     int listMatches = 0, arrayMatches = 0, unrolledMatches = 0, tableMatches = 0;
  
      // Time LinkedList search/filter (averaged over Q2_ITERATIONS runs)
      auto startListSearch = std::chrono::high_resolution_clock::now();
      for(int k=0; k < Q2_ITERATIONS; ++k) { 
          Node<Transaction>* current = transactionList.getHead();
          while (current != nullptr) { 
-             if (strcmp(current->data.category.c_str(), electronicsCategory.c_str()) == 0) {
-                  if (strcmp(current->data.paymentMethod.c_str(), creditCardPayment.c_str()) == 0) { } 
+             if (current->data.category == electronicsCategory) {
+                  if (current->data.paymentMethod == creditCardPayment) { listMatches++; } 
              }
              current = current->next;
          }
@@ -333,8 +404,8 @@
      auto startArraySearch = std::chrono::high_resolution_clock::now();
       for(int k=0; k < Q2_ITERATIONS; ++k) { 
          for (int i = 0; i < transactionArray.getSize(); ++i) { 
-              if (strcmp(transactionArray[i].category.c_str(), electronicsCategory.c_str()) == 0) {
-                 if (strcmp(transactionArray[i].paymentMethod.c_str(), creditCardPayment.c_str()) == 0) { } 
+              if (transactionArray[i].category == electronicsCategory) {
+                 if (transactionArray[i].paymentMethod == creditCardPayment) { arrayMatches++; } 
              }
          }
      }
@@ -343,12 +414,46 @@
      std::chrono::duration<double, std::micro> arraySearchTime = (endArraySearch - startArraySearch) / Q2_ITERATIONS;
  
  
+     // Time UnrolledList search/filter: a list whose nodes hold blocks of transactions
+     UnrolledList<Transaction> transactionBlocks;
+     for (auto it = transactionList.begin(); it != transactionList.end(); ++it) { transactionBlocks.insert(*it); }
+     auto startUnrolledSearch = std::chrono::high_resolution_clock::now();
+     for(int k=0; k < Q2_ITERATIONS; ++k) { 
+         for (UnrolledNode<Transaction>* block = transactionBlocks.getHead(); block != nullptr; block = block->next) { 
+             for (int i = 0; i < block->count; ++i) { 
+                 if (block->items[i].category == electronicsCategory) {
+                     if (block->items[i].paymentMethod == creditCardPayment) { unrolledMatches++; } 
+                 }
+             }
+         }
+     }
+     auto endUnrolledSearch = std::chrono::high_resolution_clock::now();
+     std::chrono::duration<double, std::micro> unrolledSearchTime = (endUnrolledSearch - startUnrolledSearch) / Q2_ITERATIONS;
+     // Time the columnar table: the scan reads only the category and payment columns
+     TransactionTable transactionTable(transactionArray.getSize());
+     for (int i = 0; i < transactionArray.getSize(); ++i) {
+         const Transaction& t = transactionArray[i];
+         transactionTable.append(t.dateKey, t.priceCents, t.category, t.paymentMethod, t.customerId, t.productId);
+     }
+     auto startTableSearch = std::chrono::high_resolution_clock::now();
+     for(int k=0; k < Q2_ITERATIONS; ++k) { 
+         int paidWith = 0; transactionTable.countCategory(electronicsCategory, creditCardPayment, paidWith); tableMatches += paidWith;
+     }
+     auto endTableSearch = std::chrono::high_resolution_clock::now();
+     std::chrono::duration<double, std::micro> tableSearchTime = (endTableSearch - startTableSearch) / Q2_ITERATIONS;
+     if (listMatches != arrayMatches || unrolledMatches != arrayMatches || tableMatches != arrayMatches) {
+         std::cerr << "Warning: Q2 filters disagree (" << listMatches << ", " << arrayMatches << ", " << unrolledMatches << ", " << tableMatches << ")" << std::endl;
+     }
+ 
+ 
      // Display Q2 results (using counts gathered during loading)
      // Calculate percentage
      double percentage = (electronicsTotalCount == 0) ? 0.0 : (static_cast<double>(electronicsCreditCardCount) / electronicsTotalCount) * 100.0;
      // Print counts
      std::cout << "Total 'Electronics' purchases found: " << electronicsTotalCount << std::endl;
      std::cout << "'Electronics' purchases using 'Credit Card': " << electronicsCreditCardCount << std::endl;
+     char revenue[24]; formatCents(electronicsRevenueCents, revenue);
+     std::cout << "Total 'Electronics' revenue: " << revenue << std::endl;
      // Print percentage
      std::cout << std::fixed << std::setprecision(2); // Set precision for percentage
      std::cout << "Percentage of Electronics purchases made with Credit Card: " << percentage << "%" << std::endl;
@@ -356,6 +461,8 @@
      std::cout << std::fixed << std::setprecision(3); // Set precision for microseconds
      std::cout << "Linear Filter Avg Time (LinkedList): " << listSearchTime.count() << " us" << std::endl;
      std::cout << "Linear Filter Avg Time (Array):      " << arraySearchTime.count() << " us" << std::endl;
+     std::cout << "Linear Filter Avg Time (UnrolledList): " << unrolledSearchTime.count() << " us" << std::endl;
+     std::cout << "Linear Filter Avg Time (TransactionTable): " << tableSearchTime.count() << " us" << std::endl;
  
  
      // --- Q3: Frequent Words in 1-Star Reviews (Heap Sort) ---
@@ -375,9 +482,12 @@
      const int numStopWords = sizeof(stopWordsArr) / sizeof(stopWordsArr[0]);
  
      // Check if any words were actually processed
-     if (wordFrequencies.getSize() == 0) {
+     if (wordCounts.getSize() == 0) {
          std::cout << "No 1-star reviews found or no words extracted." << std::endl;
      } else {
+          // Word counts in order of first appearance, as a list for the sort comparison
+          LinkedList<WordFreq> wordFrequencies;
+          for (const WordCountMap::Entry& e : wordCounts) { wordFrequencies.insert(WordFreq(String(e.word, e.length), static_cast<int>(e.count))); }
           // Create Array version for sorting comparison
           Array<WordFreq> wordArray = linkedListToArray(wordFrequencies);
  
@@ -0,0 +1,235 @@
+#ifndef SEGMENTED_ARRAY_HPP
+#define SEGMENTED_ARRAY_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Array.hpp"
+
+// log2 of the elements per SegmentedArray block: about 64 KB, at least 16 elements
+constexpr int segmentBlockShift(size_t elementSize, int shift = 4) {
+    return (elementSize << (shift + 1)) <= 64 * 1024 ? segmentBlockShift(elementSize, shift + 1) : shift;
+}
+
+// Growable array made of fixed-size blocks plus a small index of block
+// pointers. Growing allocates one more block and never moves an element, so
+// element addresses stay valid for the element's lifetime, no element is
+// copied more than once, and the only thing that doubles is the index (one
+// pointer per block). Element i is blocks[i / BLOCK_SIZE][i % BLOCK_SIZE],
+// which is O(1) since BLOCK_SIZE is a power of two.
+//
+// Meant for collecting rows of unknown count: fill it while streaming, then
+// moveTo() an exactly reserved Array, which frees each block as soon as it
+// has been emptied.
+template<typename T, typename Access = DefaultAccess>
+class SegmentedArray {
+    // Blocks come from plain ::operator new, as in Array
+    static_assert(alignof(T) <= alignof(std::max_align_t), "SegmentedArray does not support over-aligned types");
+
+public:
+    static const int BLOCK_SHIFT = segmentBlockShift(sizeof(T));
+    static const int BLOCK_SIZE = 1 << BLOCK_SHIFT;
+    static const int BLOCK_MASK = BLOCK_SIZE - 1;
+
+private:
+    Array<T*, UncheckedAccess> blocks;
+    int size;
+
+    static T* allocateBlock() {
+        return static_cast<T*>(::operator new(sizeof(T) * BLOCK_SIZE));
+    }
+
+    static void freeBlock(T* block) {
+        ::operator delete(block);
+    }
+
+    T& slot(int index) const {
+        return blocks.data()[index >> BLOCK_SHIFT][index & BLOCK_MASK];
+    }
+
+public:
+    // Random-access iterator over the elements. It reads the block index, so
+    // like an Array pointer it is invalidated by growth; element addresses
+    // are not.
+    template<bool Const>
+    class IteratorBase {
+    private:
+        T* const* blockPtrs;
+        int index;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        IteratorBase(T* const* b = nullptr, int i = 0) : blockPtrs(b), index(i) {}
+
+        // iterator -> const_iterator
+        template<bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        IteratorBase(const IteratorBase<OtherConst>& other) : blockPtrs(other.blocksPointer()), index(other.position()) {}
+
+        T* const* blocksPointer() const { return blockPtrs; }
+        int position() const { return index; }
+
+        reference operator*() const { return blockPtrs[index >> BLOCK_SHIFT][index & BLOCK_MASK]; }
+        pointer operator->() const { return &**this; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        IteratorBase& operator++() { ++index; return *this; }
+        IteratorBase& operator--() { --index; return *this; }
+        IteratorBase operator++(int) { IteratorBase temp = *this; ++index; return temp; }
+        IteratorBase operator--(int) { IteratorBase temp = *this; --index; return temp; }
+        IteratorBase& operator+=(difference_type n) { index += static_cast<int>(n); return *this; }
+        IteratorBase& operator-=(difference_type n) { index -= static_cast<int>(n); return *this; }
+
+        friend IteratorBase operator+(IteratorBase it, difference_type n) { return it += n; }
+        friend IteratorBase operator+(difference_type n, IteratorBase it) { return it += n; }
+        friend IteratorBase operator-(IteratorBase it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const IteratorBase& a, const IteratorBase& b) { return a.index - b.index; }
+
+        bool operator==(const IteratorBase& other) const { return index == other.index; }
+        bool operator!=(const IteratorBase& other) const { return index != other.index; }
+        bool operator<(const IteratorBase& other) const { return index < other.index; }
+        bool operator>(const IteratorBase& other) const { return index > other.index; }
+        bool operator<=(const IteratorBase& other) const { return index <= other.index; }
+        bool operator>=(const IteratorBase& other) const { return index >= other.index; }
+    };
+
+    typedef IteratorBase<false> Iterator;
+    typedef IteratorBase<true> ConstIterator;
+
+    SegmentedArray() : blocks(4), size(0) {}
+
+    ~SegmentedArray() {
+        clear();
+    }
+
+    // Move constructor; other is left empty
+    SegmentedArray(SegmentedArray&& other) noexcept : blocks(std::move(other.blocks)), size(other.size) {
+        other.size = 0;
+    }
+
+    SegmentedArray(const SegmentedArray& other) : blocks(other.blocks.getSize()), size(0) {
+        for (int i = 0; i < other.size; i++) push_back(other.slot(i));
+    }
+
+    SegmentedArray& operator=(const SegmentedArray& other) {
+        if (this != &other) {
+            SegmentedArray copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    SegmentedArray& operator=(SegmentedArray&& other) noexcept {
+        if (this != &other) {
+            clear();
+            blocks = std::move(other.blocks);
+            size = other.size;
+            other.size = 0;
+        }
+        return *this;
+    }
+
+    // Element access, checked according to Access
+    T& operator[](int index) {
+        Access::check(index, size);
+        return slot(index);
+    }
+
+    const T& operator[](int index) const {
+        Access::check(index, size);
+        return slot(index);
+    }
+
+    // Always checked
+    T& at(int index) {
+        CheckedAccess::check(index, size);
+        return slot(index);
+    }
+
+    const T& at(int index) const {
+        CheckedAccess::check(index, size);
+        return slot(index);
+    }
+
+    Iterator begin() { return Iterator(blocks.data(), 0); }
+    Iterator end() { return Iterator(blocks.data(), size); }
+    ConstIterator begin() const { return ConstIterator(blocks.data(), 0); }
+    ConstIterator end() const { return ConstIterator(blocks.data(), size); }
+
+    // Capacity
+    bool empty() const { return size == 0; }
+    int getSize() const { return size; }
+    int getCapacity() const { return blocks.getSize() << BLOCK_SHIFT; }
+    int getBlockCount() const { return blocks.getSize(); }
+
+    // Allocates blocks for at least n elements
+    void reserve(int n) {
+        while (getCapacity() < n) blocks.push_back(allocateBlock());
+    }
+
+    // Modifiers
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Constructs the element in place at the end. Nothing is ever moved, so
+    // args may refer to an element of this array.
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size == getCapacity()) blocks.push_back(allocateBlock());
+        T* element = &slot(size);
+        new (element) T(std::forward<Args>(args)...);
+        size++;
+        return *element;
+    }
+
+    void removeLast() {
+        if (size > 0) {
+            slot(--size).~T();
+        }
+    }
+
+    // Destroys every element and frees every block
+    void clear() {
+        for (int i = 0; i < size; i++) {
+            slot(i).~T();
+        }
+        for (int b = 0; b < blocks.getSize(); b++) {
+            freeBlock(blocks.data()[b]);
+        }
+        blocks = Array<T*, UncheckedAccess>(4);
+        size = 0;
+    }
+
+    // Appends every element to out, in order, and leaves this array empty.
+    // out grows once, and each block is freed as soon as it has been moved,
+    // so the extra memory at any point is one block rather than a second copy.
+    template<typename OutAccess>
+    void moveTo(Array<T, OutAccess>& out) {
+        out.reserve(out.getSize() + size);
+        for (int b = 0; b < blocks.getSize(); b++) {
+            T* block = blocks.data()[b];
+            int count = size - (b << BLOCK_SHIFT);
+            if (count > BLOCK_SIZE) count = BLOCK_SIZE;
+            for (int i = 0; i < count; i++) {
+                out.push_back(std::move(block[i]));
+                block[i].~T();
+            }
+            freeBlock(block);
+        }
+        blocks = Array<T*, UncheckedAccess>(4);
+        size = 0;
+    }
+};
+
+#endif // SEGMENTED_ARRAY_HPP
@@ -0,0 +1,118 @@
+#ifndef SIMD_SCAN_HPP
+#define SIMD_SCAN_HPP
+
+#include <cstddef>
+
+// Delimiter scanning 16/32 bytes at a time. SSE2 is the x86-64 baseline,
+// AVX2 is picked at runtime when the CPU has it, anything else falls back
+// to the scalar loop.
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define SIMD_SCAN_X86 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// Index of the lowest set bit (mask must be non-zero)
+inline int lowestBit(unsigned int mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// Scalar fallback: first byte in [p, end) equal to a, b or c, or end
+inline const char* scanDelimsScalar(const char* p, const char* end, char a, char b, char c) {
+    for (; p < end; ++p) {
+        char ch = *p;
+        if (ch == a || ch == b || ch == c) return p;
+    }
+    return end;
+}
+
+#ifdef SIMD_SCAN_X86
+
+inline const char* scanDelimsSse2(const char* p, const char* end, char a, char b, char c) {
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c);
+    while (end - p >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, va), _mm_cmpeq_epi8(chunk, vb)),
+                                    _mm_cmpeq_epi8(chunk, vc));
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(hits));
+        if (mask) return p + lowestBit(mask);
+        p += 16;
+    }
+    return scanDelimsScalar(p, end, a, b, c);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("avx2")))
+#endif
+inline const char* scanDelimsAvx2(const char* p, const char* end, char a, char b, char c) {
+    const __m256i va = _mm256_set1_epi8(a);
+    const __m256i vb = _mm256_set1_epi8(b);
+    const __m256i vc = _mm256_set1_epi8(c);
+    while (end - p >= 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i hits = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, va), _mm256_cmpeq_epi8(chunk, vb)),
+                                       _mm256_cmpeq_epi8(chunk, vc));
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(hits));
+        if (mask) return p + lowestBit(mask);
+        p += 32;
+    }
+    return scanDelimsSse2(p, end, a, b, c);
+}
+
+// True when the CPU and OS both support AVX2
+inline bool cpuHasAvx2() {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osSavesYmm = (info[2] & (1 << 27)) && ((_xgetbv(0) & 0x6) == 0x6);
+    if (!osSavesYmm) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+
+#else
+
+inline bool cpuHasAvx2() {
+    return false;
+}
+
+#endif // SIMD_SCAN_X86
+
+typedef const char* (*ScanDelimsFn)(const char*, const char*, char, char, char);
+
+inline ScanDelimsFn selectScanDelims() {
+#ifdef SIMD_SCAN_X86
+    if (cpuHasAvx2()) return scanDelimsAvx2;
+    return scanDelimsSse2;
+#else
+    return scanDelimsScalar;
+#endif
+}
+
+// First byte in [p, end) equal to a, b or c, or end if there is none.
+// Pass the same character more than once to search for fewer delimiters.
+inline const char* scanDelims(const char* p, const char* end, char a, char b, char c) {
+    static const ScanDelimsFn scan = selectScanDelims();
+    return scan(p, end, a, b, c);
+}
+
+#endif // SIMD_SCAN_HPP
@@ -0,0 +1,171 @@
+#ifndef SIMD_TEXT_HPP
+#define SIMD_TEXT_HPP
+
+#include <cstddef>
+#include "SimdScan.hpp"
+
+// In-place ASCII text kernels for the cleaning pipeline and String, working
+// 16/32 bytes at a time with the same SSE2/AVX2/scalar dispatch as
+// scanDelims. Only ASCII is touched: bytes >= 0x80 are never letters,
+// digits or spaces, matching the ctype functions in the "C" locale.
+
+// Byte classes for the scalar paths
+struct AsciiTable {
+    char lower[256];
+    bool alnumOrSpace[256];
+
+    AsciiTable() {
+        for (int c = 0; c < 256; c++) {
+            lower[c] = static_cast<char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+            alnumOrSpace[c] = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                              c == ' ' || (c >= '\t' && c <= '\r');
+        }
+    }
+};
+
+inline const AsciiTable& asciiTable() {
+    static const AsciiTable table;
+    return table;
+}
+
+inline void asciiLowerScalar(char* p, size_t n) {
+    const char* lower = asciiTable().lower;
+    for (size_t i = 0; i < n; i++) p[i] = lower[static_cast<unsigned char>(p[i])];
+}
+
+// Compacts the bytes of [p + i, p + n) that are kept into out; returns the new end
+inline char* keepAlnumSpaceScalar(char* out, const char* p, size_t i, size_t n) {
+    const bool* keep = asciiTable().alnumOrSpace;
+    for (; i < n; i++) {
+        if (keep[static_cast<unsigned char>(p[i])]) *out++ = p[i];
+    }
+    return out;
+}
+
+inline size_t keepAlnumSpaceScalar(char* p, size_t n) {
+    return static_cast<size_t>(keepAlnumSpaceScalar(p, p, 0, n) - p);
+}
+
+#ifdef SIMD_SCAN_X86
+
+// Lanes whose byte is in [lo, lo + count), using a signed compare after
+// shifting lo to -128
+inline __m128i inRangeSse2(__m128i v, char lo, char count) {
+    __m128i shifted = _mm_add_epi8(v, _mm_set1_epi8(static_cast<char>(128 - lo)));
+    return _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + count)));
+}
+
+inline void asciiLowerSse2(char* p, size_t n) {
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i upper = inRangeSse2(v, 'A', 26);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_or_si128(v, _mm_and_si128(upper, caseBit)));
+    }
+    asciiLowerScalar(p + i, n - i);
+}
+
+inline size_t keepAlnumSpaceSse2(char* p, size_t n) {
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i space = _mm_set1_epi8(' ');
+    char* out = p;
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i keep = _mm_or_si128(
+            _mm_or_si128(inRangeSse2(_mm_or_si128(v, caseBit), 'a', 26), inRangeSse2(v, '0', 10)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, space), inRangeSse2(v, '\t', 5)));
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(keep));
+        if (mask == 0xFFFF) {
+            // Whole block kept: one store, which never passes the unread input
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+            out += 16;
+        } else {
+            for (; mask; mask &= mask - 1) *out++ = p[i + static_cast<size_t>(lowestBit(mask))];
+        }
+    }
+    return static_cast<size_t>(keepAlnumSpaceScalar(out, p, i, n) - p);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("avx2")))
+#endif
+inline __m256i inRangeAvx2(__m256i v, char lo, char count) {
+    __m256i shifted = _mm256_add_epi8(v, _mm256_set1_epi8(static_cast<char>(128 - lo)));
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + count)), shifted);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("avx2")))
+#endif
+inline void asciiLowerAvx2(char* p, size_t n) {
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        __m256i upper = inRangeAvx2(v, 'A', 26);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_or_si256(v, _mm256_and_si256(upper, caseBit)));
+    }
+    asciiLowerSse2(p + i, n - i);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("avx2")))
+#endif
+inline size_t keepAlnumSpaceAvx2(char* p, size_t n) {
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+    const __m256i space = _mm256_set1_epi8(' ');
+    char* out = p;
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        __m256i keep = _mm256_or_si256(
+            _mm256_or_si256(inRangeAvx2(_mm256_or_si256(v, caseBit), 'a', 26), inRangeAvx2(v, '0', 10)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, space), inRangeAvx2(v, '\t', 5)));
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(keep));
+        if (mask == 0xFFFFFFFFu) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+            out += 32;
+        } else {
+            for (; mask; mask &= mask - 1) *out++ = p[i + static_cast<size_t>(lowestBit(mask))];
+        }
+    }
+    return static_cast<size_t>(keepAlnumSpaceScalar(out, p, i, n) - p);
+}
+
+#endif // SIMD_SCAN_X86
+
+typedef void (*AsciiLowerFn)(char*, size_t);
+typedef size_t (*KeepAlnumSpaceFn)(char*, size_t);
+
+inline AsciiLowerFn selectAsciiLower() {
+#ifdef SIMD_SCAN_X86
+    return cpuHasAvx2() ? asciiLowerAvx2 : asciiLowerSse2;
+#else
+    return asciiLowerScalar;
+#endif
+}
+
+inline KeepAlnumSpaceFn selectKeepAlnumSpace() {
+#ifdef SIMD_SCAN_X86
+    return cpuHasAvx2() ? keepAlnumSpaceAvx2 : keepAlnumSpaceSse2;
+#else
+    return keepAlnumSpaceScalar;
+#endif
+}
+
+// Lowercases A-Z in the n bytes at p
+inline void asciiLower(char* p, size_t n) {
+    static const AsciiLowerFn lower = selectAsciiLower();
+    lower(p, n);
+}
+
+// Drops every byte that is not an ASCII letter, digit or whitespace,
+// shifting the rest down; returns the new length
+inline size_t keepAlnumSpace(char* p, size_t n) {
+    static const KeepAlnumSpaceFn keep = selectKeepAlnumSpace();
+    return keep(p, n);
+}
+
+#endif // SIMD_TEXT_HPP
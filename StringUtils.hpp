@@ -2,48 +2,27 @@
 #define STRING_UTILS_HPP
 
 #include "CustomString.hpp"
-#include "Array.hpp"
-#include <fstream>
-#include <sstream>
+#include "CSVReader.hpp"
+#include "Arena.hpp"
 
-// Type alias for String array
-using StringArray = Array<String>;
-
-// Function to split string by delimiter
-inline StringArray split(const String& str, char delimiter) {
-    StringArray tokens;
-    const char* cstr = str.c_str();
-    size_t start = 0;
-    size_t end = 0;
-    
-    while (end < strlen(cstr)) {
-        if (cstr[end] == delimiter) {
-            if (end > start) {
-                tokens.push_back(String(cstr + start, end - start));
-            }
-            start = end + 1;
-        }
-        end++;
-    }
-    
-    if (end > start) {
-        tokens.push_back(String(cstr + start, end - start));
-    }
-    
-    return tokens;
+// Copies a mapped field into an owning String, unescaping "" in quoted fields
+inline String toString(const FieldView& field) {
+    if (!field.escaped) return String(field.ptr, field.len);
+    std::string text = field.str();
+    return String(text.c_str(), text.size());
 }
 
-// Helper function to read CSV line
-inline StringArray readCSVLine(std::ifstream& file) {
-    if (!file.good()) {
-        return StringArray();
-    }
+// Copies a mapped field into arena and returns a String borrowing that copy
+inline String toString(const FieldView& field, Arena& arena) {
+    char* out = static_cast<char*>(arena.allocate(field.size() + 1));
+    size_t len = field.copyTo(out);
+    out[len] = '\0';
+    return String::borrow(out, len);
+}
 
-    char buffer[1024];
-    if (file.getline(buffer, 1024)) {
-        return split(String(buffer), ',');
-    }
-    return StringArray();
+// Same for text that is already unescaped
+inline String toString(const char* str, size_t len, Arena& arena) {
+    return String::borrow(arena.copy(str, len), len);
 }
 
 #endif // STRING_UTILS_HPP 
\ No newline at end of file
@@ -3,76 +3,54 @@
 
 #include <iostream>
 #include <string>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include "SymbolTable.hpp"
+#include "NodePool.hpp"
+#include "Array.hpp"
 using namespace std;
 
-template <typename T>
-class Array{
-    private:
-        T* data;
-        int capacity;
-        int size;
-    
-    public:
-        Array(int initial_capacity = 1000){
-            capacity = initial_capacity;
-            data = new T[capacity];
-            size = 0;
-        }
-
-        ~Array(){
-            delete[] data;
-        }
-
-        void add(const T& element){
-            if (size >= capacity){
-                resize();
-            }
-            data[size++] = element;
-        }
-
-        T& get(int index){
-            if (index >= 0 && index < size){
-                return data[index];
-            }
-            else{
-                throw std::out_of_range("Index out of range");
-            }
-        }
-
-        int getSize() const{
-            return size;
-        }
-
-        void removeLast(){
-            if (size > 0) {
-                size--;
-            }
-        }
-
-    private:
-        void resize(){
-            int new_capacity = capacity * 2;
-            T* new_data = new T[new_capacity];
-            for (int i = 0; i < size; i++){
-                new_data[i] = data[i];
-            }
-            delete[] data;
-            data = new_data;
-            capacity = new_capacity;
-        }
-    };
-
-template <typename T>
+// Doubly-linked list. It is deliberately not intrusive: the list allocates a
+// Node around each value, so stored types need no link fields of their own.
+// Given a Node*, moving it (splice) or removing it is O(1) and never
+// allocates, as is removing at either end.
+// Nodes are allocated from a per-list NodePool unless UsePool is false, which
+// is why nodes can only be spliced within the list that created them.
+template <typename T, bool UsePool = true>
 class LinkedList {
     public:
         struct Node{
             T data;
             Node* next;
+            Node* prev;
         };
 
         Node* head;
         Node* tail;
         int size;
+
+    private:
+        NodePool<Node, UsePool> pool;
+
+        // Detaches first..last (inclusive) from the chain; size is unchanged
+        void unlink(Node* first, Node* last){
+            if(first->prev) first->prev->next = last->next;
+            else head = last->next;
+            if(last->next) last->next->prev = first->prev;
+            else tail = first->prev;
+        }
+
+        // Links first..last in before position (nullptr = at the end)
+        void link(Node* position, Node* first, Node* last){
+            Node* before = position ? position->prev : tail;
+            first->prev = before;
+            last->next = position;
+            if(before) before->next = first;
+            else head = first;
+            if(position) position->prev = last;
+            else tail = last;
+        }
     
     public:
     LinkedList(){
@@ -82,14 +60,10 @@ class LinkedList {
     }
 
     ~LinkedList(){
-        Node* current = head;
-        while(current != nullptr){
-            Node* next = current->next;
-            delete current;
-            current = next;
-        }
+        pool.releaseAll(head); // Frees the whole list at once
     }
 
+    // Relinks the list from a chain built through the next pointers
     void setHead(Node* newHead){
         head = newHead;
         tail = nullptr;
@@ -97,6 +71,7 @@ class LinkedList {
 
         Node* current = newHead;
         while(current != nullptr){
+            current->prev = tail;
             tail = current;
             size++;
             current = current->next;
@@ -104,17 +79,80 @@ class LinkedList {
     }
 
     void add(const T& value){
-        Node* newNode = new Node{ value, nullptr};
-        if(!head){
-            head = newNode;
-            tail = newNode;
-        }else{
-            tail->next = newNode;
-            tail = newNode;
-        }
+        pushBack(value);
+    }
+
+    void add(T&& value){
+        pushBack(std::move(value));
+    }
+
+    void pushBack(const T& value){
+        Node* newNode = pool.create(value, nullptr, nullptr);
+        link(nullptr, newNode, newNode);
         size++;
     }
 
+    // Moves value into the new node instead of copying it
+    void pushBack(T&& value){
+        Node* newNode = pool.create(std::move(value), nullptr, nullptr);
+        link(nullptr, newNode, newNode);
+        size++;
+    }
+
+    void pushFront(const T& value){
+        Node* newNode = pool.create(value, nullptr, nullptr);
+        link(head, newNode, newNode);
+        size++;
+    }
+
+    void pushFront(T&& value){
+        Node* newNode = pool.create(std::move(value), nullptr, nullptr);
+        link(head, newNode, newNode);
+        size++;
+    }
+
+    // Removes node from the list in O(1)
+    void remove(Node* node){
+        unlink(node, node);
+        pool.destroy(node);
+        size--;
+    }
+
+    void popFront(){
+        if(head) remove(head);
+    }
+
+    void popBack(){
+        if(tail) remove(tail);
+    }
+
+    void removeLast(){
+        popBack();
+    }
+
+    // Moves first..last (inclusive, in list order) before position, or to
+    // the end when position is nullptr. All nodes must belong to this list
+    // and position must not lie inside the moved range.
+    void splice(Node* position, Node* first, Node* last){
+        if(position == first) return;
+        unlink(first, last);
+        link(position, first, last);
+    }
+
+    void moveBefore(Node* node, Node* position){
+        splice(position, node, node);
+    }
+
+    T& front(){
+        if(!head) throw out_of_range("List is empty");
+        return head->data;
+    }
+
+    T& back(){
+        if(!tail) throw out_of_range("List is empty");
+        return tail->data;
+    }
+
     T& get(int index){
         Node* current = head;
         for(int i = 0; i < index && current != nullptr; i++){
@@ -128,43 +166,32 @@ class LinkedList {
         return size;
     }
 
-    void removeLast(){
-        if(!head) return;
-
-        if (head == tail){
-            delete head;
-            head = tail = nullptr;
-        }else{
-            Node* current = head;
-            while(current->next !=tail){
-                current = current->next;
-            }
-            delete tail;
-            current->next = nullptr;
-            tail = current;
-        }
-        size--;
-    }
-
     Node* getHead() const{
         return head;
     }
+
+    // Start of a reverse walk through the prev pointers
+    Node* getTail() const{
+        return tail;
+    }
 };
 
+// IDs, category and payment method are interned symbols (see SymbolTable.hpp)
 struct Review{
-    string productID;
-    string customerID;
+    Symbol productID;
+    Symbol customerID;
     int rating;
     string reviewText;
 };
 
 struct Transaction{
-    string customerID;
-    string product;
-    double price;
+    Symbol customerID;
+    Symbol product;
+    int64_t priceCents;
     string date;
-    string category;
-    string paymentMethod;
+    uint32_t dateKey; // YYYYMMDD, so dates order as integers
+    Symbol category;
+    Symbol paymentMethod;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,210 @@
+#ifndef SYMBOL_TABLE_HPP
+#define SYMBOL_TABLE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include "Arena.hpp"
+#include "Array.hpp"
+#include "CSVReader.hpp"
+#include "CustomString.hpp"
+#include "Hash.hpp"
+
+// Interning table for the repetitive columns (customer and product IDs,
+// category, payment method). Each distinct value gets a dense 32-bit symbol
+// the first time it is seen, so records can store symbols and compare,
+// group and hash those columns as integers. Symbols are numbered from 0 in
+// order of first appearance, which makes them usable as array indices.
+//
+// intern() may be called from several loader threads at once. New values
+// are only added while loading, so reads go through a snapshot instead of a
+// lock: the slot array is published with an atomic pointer, a slot only
+// ever changes from empty to an entry that is complete before it is stored,
+// and a slot array replaced by grow() is kept until the table is destroyed.
+// A lookup that misses in the snapshot retries under the mutex, which also
+// serialises adding. Plain C++11: no std::shared_mutex.
+
+typedef uint32_t Symbol;
+const Symbol NO_SYMBOL = 0xFFFFFFFFu;
+
+class SymbolTable {
+private:
+    // Lives in the arena and never moves once published
+    struct Entry {
+        const char* name;   // '\0'-terminated copy in the arena
+        uint32_t length;
+        uint32_t hash;
+        Symbol id;
+
+        Entry(const char* n, uint32_t len, uint32_t h, Symbol i) : name(n), length(len), hash(h), id(i) {}
+    };
+
+    // Open addressing, linear probing; nullptr = empty
+    struct Slots {
+        uint32_t mask;
+        std::atomic<const Entry*>* slots;
+        Slots* replaced;    // The array this one replaced, freed with the table
+
+        Slots(uint32_t m, Slots* older) : mask(m), slots(new std::atomic<const Entry*>[m + 1]), replaced(older) {
+            for (uint32_t i = 0; i <= mask; i++) slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~Slots() {
+            delete[] slots;
+        }
+    };
+
+    Arena bytes;                    // Written under the mutex only
+    Array<const Entry*> entries;    // By symbol; under the mutex
+    std::atomic<Slots*> current;
+    mutable std::mutex lock;
+
+    // Folds a hashBytes value into the 32 bits kept per entry
+    static uint32_t fold(uint64_t h) {
+        return static_cast<uint32_t>(h ^ (h >> 32));
+    }
+
+    // Safe without the lock: may miss a value being added concurrently
+    static const Entry* findIn(const Slots* table, const char* str, size_t len, uint32_t hash) {
+        for (uint32_t i = hash & table->mask;; i = (i + 1) & table->mask) {
+            const Entry* e = table->slots[i].load(std::memory_order_acquire);
+            if (!e) return nullptr;
+            if (e->hash == hash && e->length == len && memcmp(e->name, str, len) == 0) return e;
+        }
+    }
+
+    static void place(Slots* table, const Entry* e) {
+        uint32_t i = e->hash & table->mask;
+        while (table->slots[i].load(std::memory_order_relaxed)) i = (i + 1) & table->mask;
+        table->slots[i].store(e, std::memory_order_release);
+    }
+
+    // Publishes a slot array twice the size; caller holds the lock
+    Slots* grow(Slots* table) {
+        Slots* bigger = new Slots(table->mask * 2 + 1, table);
+        for (int id = 0; id < entries.getSize(); id++) {
+            place(bigger, entries[id]);
+        }
+        current.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+public:
+    SymbolTable() : bytes(64 * 1024), entries(64), current(new Slots(127, nullptr)) {}
+
+    ~SymbolTable() {
+        Slots* table = current.load(std::memory_order_relaxed);
+        while (table) {
+            Slots* older = table->replaced;
+            delete table;
+            table = older;
+        }
+    }
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    // Symbol for the value, adding it if it is new. strHash is
+    // hashBytes(str, len), for callers that already have it.
+    Symbol intern(const char* str, size_t len, uint64_t strHash) {
+        uint32_t hash = fold(strHash);
+        const Entry* found = findIn(current.load(std::memory_order_acquire), str, len, hash);
+        if (found) return found->id;
+
+        std::lock_guard<std::mutex> writing(lock);
+        Slots* table = current.load(std::memory_order_relaxed);
+        found = findIn(table, str, len, hash);
+        if (found) return found->id;
+
+        // Keep the load factor at or below one half
+        Symbol id = static_cast<Symbol>(entries.getSize());
+        if ((id + 1) * 2 > table->mask + 1) table = grow(table);
+        const char* name = bytes.copy(str, len);
+        const Entry* e = new (bytes.allocate(sizeof(Entry), alignof(Entry))) Entry(name, static_cast<uint32_t>(len), hash, id);
+        entries.push_back(e);
+        place(table, e);
+        return id;
+    }
+
+    Symbol intern(const char* str, size_t len) {
+        return intern(str, len, hashBytes(str, len));
+    }
+
+    Symbol intern(const char* str) {
+        return intern(str, strlen(str));
+    }
+
+    // Reuses the hash the String has cached
+    Symbol intern(const String& str) {
+        return intern(str.c_str(), str.size(), str.hash());
+    }
+
+    Symbol intern(const std::string& str) {
+        return intern(str.data(), str.size());
+    }
+
+    // Fields with escaped quotes are unescaped before interning
+    Symbol intern(const FieldView& field) {
+        if (!field.escaped) return intern(field.ptr, field.len);
+        std::string text = field.str();
+        return intern(text.data(), text.size());
+    }
+
+    // Symbol of an existing value, or NO_SYMBOL; never adds. Lock-free, so
+    // only a value added after loading finished could be missed.
+    Symbol find(const char* str, size_t len) const {
+        const Entry* e = findIn(current.load(std::memory_order_acquire), str, len, fold(hashBytes(str, len)));
+        return e ? e->id : NO_SYMBOL;
+    }
+
+    Symbol find(const char* str) const {
+        return find(str, strlen(str));
+    }
+
+    // Text of a symbol; the pointer stays valid for the table's lifetime
+    const char* name(Symbol id) const {
+        std::lock_guard<std::mutex> reading(lock);
+        return id < static_cast<Symbol>(entries.getSize()) ? entries[static_cast<int>(id)]->name : "";
+    }
+
+    size_t length(Symbol id) const {
+        std::lock_guard<std::mutex> reading(lock);
+        return id < static_cast<Symbol>(entries.getSize()) ? entries[static_cast<int>(id)]->length : 0;
+    }
+
+    int size() const {
+        std::lock_guard<std::mutex> reading(lock);
+        return entries.getSize();
+    }
+};
+
+// Table shared by every loader in the program
+inline SymbolTable& globalSymbols() {
+    static SymbolTable table;
+    return table;
+}
+
+inline Symbol intern(const char* str) {
+    return globalSymbols().intern(str);
+}
+
+inline Symbol intern(const FieldView& field) {
+    return globalSymbols().intern(field);
+}
+
+inline Symbol intern(const std::string& str) {
+    return globalSymbols().intern(str);
+}
+
+inline Symbol intern(const String& str) {
+    return globalSymbols().intern(str);
+}
+
+inline const char* symbolName(Symbol id) {
+    return globalSymbols().name(id);
+}
+
+#endif // SYMBOL_TABLE_HPP
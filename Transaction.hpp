@@ -1,17 +1,23 @@
 #ifndef TRANSACTION_HPP
 #define TRANSACTION_HPP
 
+#include <cstdint>
 #include "CustomString.hpp"
+#include "SymbolTable.hpp"
 
+// IDs, category and payment method are interned symbols (see SymbolTable.hpp)
 struct Transaction {
-    MyString customerID, product, date, category, paymentMethod;
-    double price;
+    Symbol customerID, product;
+    MyString date;
+    Symbol category, paymentMethod;
+    int64_t priceCents;
+    uint32_t dateKey; // YYYYMMDD, so dates order as integers
     
-    Transaction() : price(0.0) {}
+    Transaction() : customerID(NO_SYMBOL), product(NO_SYMBOL), category(NO_SYMBOL), paymentMethod(NO_SYMBOL), priceCents(0), dateKey(0) {}
     
-    Transaction(const MyString& cid, const MyString& p, double pr, 
-               const MyString& d, const MyString& c, const MyString& pm)
-        : customerID(cid), product(p), price(pr), date(d), category(c), paymentMethod(pm) {}
+    Transaction(Symbol cid, Symbol p, int64_t cents, 
+               const MyString& d, uint32_t key, Symbol c, Symbol pm)
+        : customerID(cid), product(p), date(d), category(c), paymentMethod(pm), priceCents(cents), dateKey(key) {}
 };
 
 #endif // TRANSACTION_HPP
@@ -0,0 +1,100 @@
+#ifndef TRANSACTION_TABLE_HPP
+#define TRANSACTION_TABLE_HPP
+
+#include <cstdint>
+#include "Array.hpp"
+#include "SymbolTable.hpp"
+
+// Transactions stored column by column: one contiguous array per field
+// instead of an array of records. A filter or aggregate reads only the
+// columns it tests, e.g. a Q2 scan touches 8 bytes per row (category and
+// payment symbols) rather than whole records. Text columns hold interned
+// symbols; the date string is not kept since formatDateKey rebuilds it.
+//
+// row(i) returns a lightweight view with record-style accessors, so code
+// written against a Transaction struct can move over one loop at a time.
+class TransactionTable {
+private:
+    Array<uint32_t> dateKeys;      // YYYYMMDD
+    Array<int64_t> prices;         // Cents
+    Array<Symbol> categories;
+    Array<Symbol> payments;
+    Array<Symbol> customers;
+    Array<Symbol> products;
+
+public:
+    // One row of the table, read through the columns
+    class RowView {
+    private:
+        const TransactionTable* table;
+        int index;
+
+    public:
+        RowView(const TransactionTable* t, int i) : table(t), index(i) {}
+
+        int row() const { return index; }
+        uint32_t dateKey() const { return table->dateKeys.data()[index]; }
+        int64_t priceCents() const { return table->prices.data()[index]; }
+        Symbol category() const { return table->categories.data()[index]; }
+        Symbol paymentMethod() const { return table->payments.data()[index]; }
+        Symbol customerId() const { return table->customers.data()[index]; }
+        Symbol productId() const { return table->products.data()[index]; }
+    };
+
+    explicit TransactionTable(int initialCapacity = 1024)
+        : dateKeys(initialCapacity), prices(initialCapacity), categories(initialCapacity),
+          payments(initialCapacity), customers(initialCapacity), products(initialCapacity) {}
+
+    int getSize() const { return dateKeys.getSize(); }
+    bool empty() const { return dateKeys.empty(); }
+
+    void reserve(int n) {
+        dateKeys.reserve(n);
+        prices.reserve(n);
+        categories.reserve(n);
+        payments.reserve(n);
+        customers.reserve(n);
+        products.reserve(n);
+    }
+
+    void append(uint32_t dateKey, int64_t priceCents, Symbol category, Symbol paymentMethod,
+                Symbol customerId, Symbol productId) {
+        dateKeys.push_back(dateKey);
+        prices.push_back(priceCents);
+        categories.push_back(category);
+        payments.push_back(paymentMethod);
+        customers.push_back(customerId);
+        products.push_back(productId);
+    }
+
+    // Bounds-checked row view
+    RowView row(int i) const {
+        CheckedAccess::check(i, getSize());
+        return RowView(this, i);
+    }
+
+    // Whole columns, for scans
+    ArraySpan<const uint32_t> dateKeyColumn() const { return dateKeys.span(); }
+    ArraySpan<const int64_t> priceColumn() const { return prices.span(); }
+    ArraySpan<const Symbol> categoryColumn() const { return categories.span(); }
+    ArraySpan<const Symbol> paymentColumn() const { return payments.span(); }
+    ArraySpan<const Symbol> customerColumn() const { return customers.span(); }
+    ArraySpan<const Symbol> productColumn() const { return products.span(); }
+
+    // Rows in category, and how many of those were paid with payment.
+    // Reads the category and payment columns only.
+    int countCategory(Symbol category, Symbol payment, int& paidWith) const {
+        const Symbol* cat = categories.data();
+        const Symbol* pay = payments.data();
+        int n = getSize(), total = 0, matched = 0;
+        for (int i = 0; i < n; i++) {
+            int inCategory = cat[i] == category;
+            total += inCategory;
+            matched += inCategory & (pay[i] == payment);
+        }
+        paidWith = matched;
+        return total;
+    }
+};
+
+#endif // TRANSACTION_TABLE_HPP
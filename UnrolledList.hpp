@@ -0,0 +1,211 @@
+#ifndef UNROLLED_LIST_HPP
+#define UNROLLED_LIST_HPP
+
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+// Linked list whose nodes each hold a small block of elements, so a scan
+// touches one allocation per block instead of one per element and walks
+// contiguous memory inside each block. Offers the same insert / remove /
+// search / Iterator / getHead contract as LinkedList.hpp.
+template<typename T>
+class UnrolledNode {
+public:
+    // Elements per node: about 512 bytes (a few cache lines), at least 4
+    static const int CAPACITY = sizeof(T) * 4 >= 512 ? 4 : static_cast<int>(512 / sizeof(T));
+
+    T items[CAPACITY];
+    int count;
+    UnrolledNode* next;
+
+    UnrolledNode() : count(0), next(nullptr) {}
+
+    bool full() const { return count == CAPACITY; }
+};
+
+template<typename T>
+class UnrolledList {
+private:
+    UnrolledNode<T>* head;
+    UnrolledNode<T>* tail;
+    int size;
+
+    void clear() {
+        UnrolledNode<T>* current = head;
+        while (current != nullptr) {
+            UnrolledNode<T>* next = current->next;
+            delete current;
+            current = next;
+        }
+        head = tail = nullptr;
+        size = 0;
+    }
+
+    // Removes items[index] from node, keeping the remaining order
+    void eraseAt(UnrolledNode<T>* prev, UnrolledNode<T>* node, int index) {
+        for (int i = index; i + 1 < node->count; i++) {
+            node->items[i] = std::move(node->items[i + 1]);
+        }
+        node->items[--node->count] = T();
+        size--;
+
+        if (node->count == 0) {
+            // Unlink the empty node
+            if (prev) prev->next = node->next;
+            else head = node->next;
+            if (tail == node) tail = prev;
+            delete node;
+            return;
+        }
+
+        // Merge with the next node when both fit in one, so blocks stay dense
+        UnrolledNode<T>* next = node->next;
+        if (next && node->count + next->count <= UnrolledNode<T>::CAPACITY) {
+            for (int i = 0; i < next->count; i++) {
+                node->items[node->count++] = std::move(next->items[i]);
+            }
+            node->next = next->next;
+            if (tail == next) tail = node;
+            delete next;
+        }
+    }
+
+public:
+    // Iterator over the elements in list order
+    class Iterator {
+    private:
+        UnrolledNode<T>* current;
+        int index;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        Iterator(UnrolledNode<T>* node = nullptr, int i = 0) : current(node), index(i) {}
+
+        T& operator*() { return current->items[index]; }
+        T* operator->() { return &current->items[index]; }
+
+        Iterator& operator++() {
+            if (current && ++index == current->count) {
+                current = current->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return current == other.current && index == other.index;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+
+        UnrolledNode<T>* getNode() const { return current; }
+    };
+
+    // Iterator methods
+    Iterator begin() { return Iterator(head, 0); }
+    Iterator end() { return Iterator(nullptr, 0); }
+
+    UnrolledList() : head(nullptr), tail(nullptr), size(0) {}
+
+    // Deep copy constructor
+    UnrolledList(const UnrolledList& other) : head(nullptr), tail(nullptr), size(0) {
+        for (UnrolledNode<T>* node = other.head; node != nullptr; node = node->next) {
+            for (int i = 0; i < node->count; i++) insert(node->items[i]);
+        }
+    }
+
+    // Deep copy assignment operator
+    UnrolledList& operator=(const UnrolledList& other) {
+        if (this != &other) {
+            clear();
+            for (UnrolledNode<T>* node = other.head; node != nullptr; node = node->next) {
+                for (int i = 0; i < node->count; i++) insert(node->items[i]);
+            }
+        }
+        return *this;
+    }
+
+    ~UnrolledList() {
+        clear();
+    }
+
+    // Appends at the tail in O(1)
+    void insert(T value) {
+        if (tail == nullptr || tail->full()) {
+            UnrolledNode<T>* node = new UnrolledNode<T>();
+            if (tail) tail->next = node;
+            else head = node;
+            tail = node;
+        }
+        tail->items[tail->count++] = std::move(value);
+        size++;
+    }
+
+    void insertAtBeginning(T value) {
+        if (head == nullptr || head->full()) {
+            UnrolledNode<T>* node = new UnrolledNode<T>();
+            node->next = head;
+            head = node;
+            if (tail == nullptr) tail = node;
+        }
+        for (int i = head->count; i > 0; i--) {
+            head->items[i] = std::move(head->items[i - 1]);
+        }
+        head->items[0] = std::move(value);
+        head->count++;
+        size++;
+    }
+
+    // Removes the first element equal to value
+    bool remove(T value) {
+        UnrolledNode<T>* prev = nullptr;
+        for (UnrolledNode<T>* node = head; node != nullptr; prev = node, node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                if (node->items[i] == value) {
+                    eraseAt(prev, node, i);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // First element equal to value, or nullptr
+    T* search(T value) {
+        for (UnrolledNode<T>* node = head; node != nullptr; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                if (node->items[i] == value) {
+                    return &node->items[i];
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    UnrolledNode<T>* getHead() const { return head; }
+
+    int getSize() const { return size; }
+
+    void display() {
+        for (auto it = begin(); it != end(); ++it) {
+            std::cout << *it << " -> ";
+        }
+        std::cout << "nullptr" << std::endl;
+    }
+};
+
+#endif // UNROLLED_LIST_HPP
@@ -0,0 +1,221 @@
+#ifndef WORD_COUNT_MAP_HPP
+#define WORD_COUNT_MAP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include "Arena.hpp"
+#include "Array.hpp"
+#include "CustomString.hpp"
+#include "Hash.hpp"
+
+// Word -> count map for the Q3 word frequencies. Counting a token is one
+// hash and, on average, one or two probes, instead of a scan over every
+// distinct word seen so far.
+//
+// Entries sit in a dense array in order of first appearance, which is also
+// the order begin()/end() visit them in. The slot array is open addressing
+// with Robin Hood probing: each slot keeps the full 64-bit hash (0 = empty)
+// and the entry index, so a probe only touches the key bytes on a hash
+// match. erase() shifts the following slots back instead of leaving
+// tombstones, and moves the last entry into the erased one's place.
+//
+// The map owns the key bytes (copied into its arena on first insert); bytes
+// of erased words are only reclaimed by clear().
+class WordCountMap {
+public:
+    struct Entry {
+        const char* word;   // '\0'-terminated copy in the arena
+        uint32_t length;
+        int64_t count;
+        uint64_t hash;
+
+        Entry() : word(""), length(0), count(0), hash(0) {}
+        Entry(const char* w, uint32_t len, int64_t c, uint64_t h) : word(w), length(len), count(c), hash(h) {}
+    };
+
+private:
+    struct Slot {
+        uint64_t hash;
+        uint32_t entry;
+    };
+
+    Arena bytes;
+    Array<Entry> entries;
+    Slot* slots;
+    uint32_t slotMask;
+
+    // How far slot i is from the slot its hash wants
+    uint32_t distance(uint32_t i, uint64_t hash) const {
+        return (i - static_cast<uint32_t>(hash)) & slotMask;
+    }
+
+    // Slot holding the word, or -1
+    int64_t findSlot(const char* word, size_t len, uint64_t hash) const {
+        for (uint32_t i = static_cast<uint32_t>(hash) & slotMask, dist = 0;; i = (i + 1) & slotMask, dist++) {
+            const Slot& s = slots[i];
+            // Robin Hood order: a resident closer to home than we are means
+            // the word would have displaced it, so it is not in the table
+            if (s.hash == 0 || distance(i, s.hash) < dist) return -1;
+            if (s.hash == hash) {
+                const Entry& e = entries.data()[s.entry];
+                if (e.length == len && memcmp(e.word, word, len) == 0) return i;
+            }
+        }
+    }
+
+    // Places a slot, displacing residents that are closer to home
+    void place(Slot incoming) {
+        for (uint32_t i = static_cast<uint32_t>(incoming.hash) & slotMask, dist = 0;; i = (i + 1) & slotMask, dist++) {
+            Slot& s = slots[i];
+            if (s.hash == 0) {
+                s = incoming;
+                return;
+            }
+            uint32_t residentDist = distance(i, s.hash);
+            if (residentDist < dist) {
+                std::swap(s, incoming);
+                dist = residentDist;
+            }
+        }
+    }
+
+    void rehash(uint32_t newMask) {
+        delete[] slots;
+        slots = new Slot[newMask + 1]();
+        slotMask = newMask;
+        for (int id = 0; id < entries.getSize(); id++) {
+            place(Slot{entries.data()[id].hash, static_cast<uint32_t>(id)});
+        }
+    }
+
+    // Adds a new word with count 0; the caller checked it is absent
+    Entry& add(const char* word, size_t len, uint64_t hash) {
+        // Keep the load factor at or below three quarters
+        uint32_t id = static_cast<uint32_t>(entries.getSize());
+        if ((id + 1) * 4 > (slotMask + 1) * 3) rehash(slotMask * 2 + 1);
+        place(Slot{hash, id});
+        return entries.emplace_back(bytes.copy(word, len), static_cast<uint32_t>(len), 0, hash);
+    }
+
+public:
+    explicit WordCountMap(int expectedWords = 64) : bytes(64 * 1024), entries(expectedWords), slots(nullptr), slotMask(0) {
+        uint32_t capacity = 16;
+        while (capacity * 3 < static_cast<uint32_t>(expectedWords) * 4) capacity *= 2;
+        slots = new Slot[capacity]();
+        slotMask = capacity - 1;
+    }
+
+    ~WordCountMap() {
+        delete[] slots;
+    }
+
+    // Entries point into the arena, so the map cannot be copied
+    WordCountMap(const WordCountMap&) = delete;
+    WordCountMap& operator=(const WordCountMap&) = delete;
+
+    // Adds by to the word's count, inserting it first if it is new, and
+    // returns the new count. hash is hashBytes(word, len).
+    int64_t increment(const char* word, size_t len, uint64_t hash, int64_t by = 1) {
+        int64_t i = findSlot(word, len, hash);
+        Entry& e = i >= 0 ? entries.data()[slots[i].entry] : add(word, len, hash);
+        e.count += by;
+        return e.count;
+    }
+
+    int64_t increment(const char* word, size_t len, int64_t by = 1) {
+        return increment(word, len, hashBytes(word, len), by);
+    }
+
+    // Reuses the hash the String has cached
+    int64_t increment(const String& word, int64_t by = 1) {
+        return increment(word.c_str(), word.size(), word.hash(), by);
+    }
+
+    int64_t increment(const std::string& word, int64_t by = 1) {
+        return increment(word.data(), word.size(), by);
+    }
+
+    // Entry for the word, or nullptr
+    const Entry* find(const char* word, size_t len) const {
+        int64_t i = findSlot(word, len, hashBytes(word, len));
+        return i >= 0 ? &entries.data()[slots[i].entry] : nullptr;
+    }
+
+    int64_t count(const char* word, size_t len) const {
+        const Entry* e = find(word, len);
+        return e ? e->count : 0;
+    }
+
+    int64_t count(const std::string& word) const {
+        return count(word.data(), word.size());
+    }
+
+    // Removes the word; returns false if it was not present
+    bool erase(const char* word, size_t len) {
+        int64_t found = findSlot(word, len, hashBytes(word, len));
+        if (found < 0) return false;
+        uint32_t i = static_cast<uint32_t>(found);
+        uint32_t id = slots[i].entry;
+
+        // Backward shift: pull each following displaced slot one step home
+        for (uint32_t next = (i + 1) & slotMask; slots[next].hash != 0 && distance(next, slots[next].hash) > 0;
+             i = next, next = (next + 1) & slotMask) {
+            slots[i] = slots[next];
+        }
+        slots[i] = Slot{0, 0};
+
+        // Keep the entries dense: the last one takes the erased one's place
+        uint32_t last = static_cast<uint32_t>(entries.getSize() - 1);
+        if (id != last) {
+            Entry& moved = entries.data()[last];
+            uint32_t s = static_cast<uint32_t>(moved.hash) & slotMask;
+            while (slots[s].entry != last || slots[s].hash != moved.hash) s = (s + 1) & slotMask;
+            slots[s].entry = id;
+            entries.data()[id] = moved;
+        }
+        entries.removeLast();
+        return true;
+    }
+
+    bool erase(const std::string& word) {
+        return erase(word.data(), word.size());
+    }
+
+    void clear() {
+        entries = Array<Entry>(64);
+        bytes.release();
+        delete[] slots;
+        slots = new Slot[16]();
+        slotMask = 15;
+    }
+
+    int getSize() const { return entries.getSize(); }
+    bool empty() const { return entries.empty(); }
+
+    // Entries in order of first appearance
+    const Entry* begin() const { return entries.begin(); }
+    const Entry* end() const { return entries.end(); }
+    const Entry& operator[](int index) const { return entries[index]; }
+
+    // The k most frequent entries, highest count first; equal counts keep
+    // their order of first appearance. k < 0 exports every entry.
+    void topK(int k, Array<Entry>& out) const {
+        int n = entries.getSize();
+        if (k < 0 || k > n) k = n;
+        Array<int> order(n > 0 ? n : 1);
+        for (int i = 0; i < n; i++) order.push_back(i);
+
+        const Entry* e = entries.data();
+        std::partial_sort(order.begin(), order.begin() + k, order.end(), [e](int a, int b) {
+            if (e[a].count != e[b].count) return e[a].count > e[b].count;
+            return a < b;
+        });
+
+        out.reserve(out.getSize() + k);
+        for (int i = 0; i < k; i++) out.push_back(e[order[i]]);
+    }
+};
+
+#endif // WORD_COUNT_MAP_HPP
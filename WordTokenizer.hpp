@@ -0,0 +1,149 @@
+#ifndef WORD_TOKENIZER_HPP
+#define WORD_TOKENIZER_HPP
+
+#include <cstddef>
+#include <cstring>
+
+// Splits review text into words for the Q3 word counts without allocating
+// per word. Words are returned as views: in KEEP_RAW mode straight into the
+// text, otherwise into a scratch buffer owned by the tokenizer that holds
+// the current word lowercased with everything but letters and digits
+// dropped. A view is valid until the next call to next() or reset().
+//
+// Characters are classified with a 256-entry table matching isspace,
+// ispunct and isalnum in the "C" locale, so bytes >= 0x80 are neither
+// separators nor kept.
+
+struct WordToken {
+    const char* ptr;
+    size_t len;
+    bool hasLetter;     // At least one a-z/A-Z, to skip words that are only digits
+};
+
+class WordTokenizer {
+public:
+    enum SplitMode {
+        SPLIT_SPACE_PUNCT,  // Whitespace and punctuation end a word
+        SPLIT_SPACE         // Only whitespace ends a word
+    };
+
+    enum KeepMode {
+        KEEP_ALNUM_LOWER,   // Keep letters and digits, lowercased
+        KEEP_RAW            // Keep every byte of the word as written
+    };
+
+private:
+    enum CharClass : unsigned char {
+        CHAR_OTHER = 0,
+        CHAR_SPACE = 1,
+        CHAR_PUNCT = 2,
+        CHAR_DIGIT = 4,
+        CHAR_LETTER = 8
+    };
+
+    struct Table {
+        unsigned char cls[256];
+        char lower[256];
+
+        Table() {
+            for (int c = 0; c < 256; c++) {
+                lower[c] = static_cast<char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+                if (c == ' ' || (c >= '\t' && c <= '\r')) cls[c] = CHAR_SPACE;
+                else if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) cls[c] = CHAR_LETTER;
+                else if (c >= '0' && c <= '9') cls[c] = CHAR_DIGIT;
+                else if (c > ' ' && c < 127) cls[c] = CHAR_PUNCT;
+                else cls[c] = CHAR_OTHER;
+            }
+        }
+    };
+
+    static const Table& table() {
+        static const Table t;
+        return t;
+    }
+
+    static const size_t LOCAL_CAPACITY = 64;
+
+    const char* pos;
+    const char* end;
+    unsigned char separators;
+    KeepMode keep;
+    char* scratch;      // local, or a heap buffer once a longer word was seen
+    size_t capacity;
+    char local[LOCAL_CAPACITY];
+
+    void grow(size_t needed) {
+        size_t newCapacity = capacity * 2;
+        if (newCapacity < needed) newCapacity = needed;
+        char* bigger = new char[newCapacity];
+        if (scratch != local) delete[] scratch;
+        scratch = bigger;
+        capacity = newCapacity;
+    }
+
+public:
+    explicit WordTokenizer(SplitMode split = SPLIT_SPACE_PUNCT, KeepMode keepMode = KEEP_ALNUM_LOWER)
+        : pos(nullptr), end(nullptr),
+          separators(split == SPLIT_SPACE_PUNCT ? CHAR_SPACE | CHAR_PUNCT : CHAR_SPACE),
+          keep(keepMode), scratch(local), capacity(LOCAL_CAPACITY) {}
+
+    WordTokenizer(const char* text, size_t len,
+                  SplitMode split = SPLIT_SPACE_PUNCT, KeepMode keepMode = KEEP_ALNUM_LOWER)
+        : WordTokenizer(split, keepMode) {
+        reset(text, len);
+    }
+
+    ~WordTokenizer() {
+        if (scratch != local) delete[] scratch;
+    }
+
+    WordTokenizer(const WordTokenizer&) = delete;
+    WordTokenizer& operator=(const WordTokenizer&) = delete;
+
+    // Starts on new text; the scratch buffer is kept
+    void reset(const char* text, size_t len) {
+        pos = text;
+        end = text + len;
+    }
+
+    // Next non-empty word, or false at the end of the text
+    bool next(WordToken& word) {
+        const Table& t = table();
+        while (pos < end) {
+            while (pos < end && (t.cls[static_cast<unsigned char>(*pos)] & separators)) pos++;
+            const char* start = pos;
+            while (pos < end && !(t.cls[static_cast<unsigned char>(*pos)] & separators)) pos++;
+            if (start == pos) break;
+
+            bool hasLetter = false;
+            if (keep == KEEP_RAW) {
+                for (const char* p = start; p < pos && !hasLetter; p++) {
+                    hasLetter = t.cls[static_cast<unsigned char>(*p)] == CHAR_LETTER;
+                }
+                word.ptr = start;
+                word.len = static_cast<size_t>(pos - start);
+                word.hasLetter = hasLetter;
+                return true;
+            }
+
+            if (static_cast<size_t>(pos - start) > capacity) grow(static_cast<size_t>(pos - start));
+            size_t len = 0;
+            for (const char* p = start; p < pos; p++) {
+                unsigned char c = static_cast<unsigned char>(*p);
+                unsigned char cls = t.cls[c];
+                if (cls & (CHAR_LETTER | CHAR_DIGIT)) {
+                    scratch[len++] = t.lower[c];
+                    hasLetter |= cls == CHAR_LETTER;
+                }
+            }
+            if (len == 0) continue; // Nothing but dropped characters
+            word.ptr = scratch;
+            word.len = len;
+            word.hasLetter = hasLetter;
+            return true;
+        }
+        return false;
+    }
+};
+
+#endif // WORD_TOKENIZER_HPP
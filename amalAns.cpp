@@ -1,8 +1,13 @@
 #include <fstream>
-#include <sstream>
 #include <ctime>
 #include <iostream>
 #include "Structure.hpp"
+#include "CSVReader.hpp"
+#include "NumberParse.hpp"
+#include "WordTokenizer.hpp"
+#include "WordCountMap.hpp"
+#include "ParallelLoader.hpp"
+#include "TransactionTable.hpp"
 #include <algorithm>
 #include <cctype>
 using namespace std;
@@ -11,6 +16,8 @@ using namespace std;
 
 
 // Load structures from files
+bool parseTransactionRow(const CSVRow& row, Transaction& t);
+bool parseReviewRow(const CSVRow& row, Review& r);
 void loadTransactions(const string& filename, Array<Transaction>& transactions);
 void loadTransactions(const string& filename, LinkedList<Transaction>& transactions);
 void loadReviews(const string& filename, Array<Review>& reviews);
@@ -23,12 +30,18 @@ void insertionSortByDate(LinkedList<Transaction>& list);
 //Search Q2
 void sentinelLinearSearch(Array<Transaction>& arr);
 void sentinelLinearSearch(LinkedList<Transaction>& list);
+void linearSearch(const TransactionTable& table);
 
 //Sort and Search Q3
-void sentinelLinearSearch1StarReviews(Array<Review>& reviews, Array<string>& words);
-void insertionSortWords(Array<string>& words);
-void sentinelLinearSearch1StarReviews(LinkedList<Review>& reviews, LinkedList<string>& words);
-void insertionSortWords(LinkedList<string>& words);
+struct WordFrequency{
+    string word;
+    int count;
+};
+
+void sentinelLinearSearch1StarReviews(Array<Review>& reviews, WordCountMap& words);
+void insertionSortWords(const WordCountMap& words, Array<WordFrequency>& frequencies);
+void sentinelLinearSearch1StarReviews(LinkedList<Review>& reviews, WordCountMap& words);
+void insertionSortWords(const WordCountMap& words, LinkedList<WordFrequency>& frequencies);
 
 int main(){
     Array<Transaction> transactions;
@@ -61,8 +74,8 @@ int main(){
 
     cout << "First 5 sorted transactions (Array):" << endl;
     for(int i = 0; i < 5 && i < transactions.getSize(); i++){
-        cout << transactions.get(i).customerID << " | "
-             << transactions.get(i).product << " | "
+        cout << symbolName(transactions.get(i).customerID) << " | "
+             << symbolName(transactions.get(i).product) << " | "
              << transactions.get(i).date << endl;
     }
     cout << "Array Insertion Sort Time: " << arraySortTime << " seconds" << endl;
@@ -83,19 +96,33 @@ int main(){
     end = clock();
     cout << "Linked List Search Time: " << double(end - start) / CLOCKS_PER_SEC << " seconds" << endl;
 
+    // Same question over the category and payment columns only
+    cout << "\n[Column Table Version]" << endl;
+    TransactionTable transactionTable(transactions.getSize() > 0 ? transactions.getSize() : 1);
+    for(int i = 0; i < transactions.getSize(); i++){
+        const Transaction& t = transactions.get(i);
+        transactionTable.append(t.dateKey, t.priceCents, t.category, t.paymentMethod, t.customerID, t.product);
+    }
+    start = clock();
+    linearSearch(transactionTable);
+    end = clock();
+    cout << "Column Table Search Time: " << double(end - start) / CLOCKS_PER_SEC << " seconds" << endl;
+
     // Q3 - Most common words in 1-star reviews
     cout << "\n========== QUESTION 3: Common Words in 1-Star Reviews ==========" << endl;
-    Array<string> OneStarWords;
+    WordCountMap OneStarWords;
+    Array<WordFrequency> OneStarFrequencies;
     start = clock();
     sentinelLinearSearch1StarReviews(reviews, OneStarWords);
-    insertionSortWords(OneStarWords);
+    insertionSortWords(OneStarWords, OneStarFrequencies);
     end = clock();
     cout << "Array 1-Star Reviews Search and Sort Time: " << double(end - start) / CLOCKS_PER_SEC << " seconds" << endl;
 
-    LinkedList<string> OneStarWordsLinkedList;
+    WordCountMap OneStarWordsLinkedList;
+    LinkedList<WordFrequency> OneStarFrequenciesLinkedList;
     start = clock();
     sentinelLinearSearch1StarReviews(reviewsLinkedList, OneStarWordsLinkedList);
-    insertionSortWords(OneStarWordsLinkedList);
+    insertionSortWords(OneStarWordsLinkedList, OneStarFrequenciesLinkedList);
     end = clock();
     cout << "Linked List 1-Star Reviews Search and Sort Time: " << double(end - start) / CLOCKS_PER_SEC << " seconds" << endl;
 
@@ -103,194 +130,155 @@ int main(){
     return 0;  
 }
 
-void loadTransactions(const string& filename, Array<Transaction>& transactions){
-    ifstream file(filename);
-
-    if(!file.is_open()){
-        cout << "Error opening file: " << filename << endl;
-        return;
+// Fills t from one clean transactions row (Customer|Product,Category,Price,Date,Payment Method)
+bool parseTransactionRow(const CSVRow& row, Transaction& t){
+    if(row.getSize() < 5){
+        return false;
     }
 
-    string line;
-    getline(file, line); // Skip header line
-
-    while(getline(file, line)){
-        stringstream ss(line);
-        string customerID, product, priceStr, date, category, paymentMethod;
-
-        getline(ss, customerID, '|');
-        getline(ss, product, ',');
-        getline(ss, category, ',');
-        getline(ss, priceStr, ',');
-        getline(ss, date, ',');
-        getline(ss, paymentMethod, ',');
-
-        Transaction t;
-        t.customerID = customerID;
-        t.product = product;
-        t.category = category;
-        t.price = stod(priceStr); // Convert string to double
-        t.date = date;
-        t.paymentMethod = paymentMethod;
-
-        transactions.add(t);
+    FieldView customerProduct = row[0];
+    long pipe = customerProduct.find('|');
+    if(pipe < 0){
+        return false;
     }
 
-    file.close();
+    t.customerID = intern(customerProduct.substr(0, pipe));
+    t.product = intern(customerProduct.substr(pipe + 1, customerProduct.size()));
+    t.category = intern(row[1]);
+    if(parsePriceCents(row[2].ptr, row[2].len, t.priceCents) != NUM_OK){
+        return false; // Price is kept as exact cents
+    }
+    if(parseDateKey(row[3].ptr, row[3].len, t.dateKey) != NUM_OK){
+        return false;
+    }
+    t.date = row[3].str();
+    t.paymentMethod = intern(row[4]);
+    return true;
 }
 
-void loadTransactions(const string& filename, LinkedList<Transaction>& transactions){
-    ifstream file(filename);
-
-    if(!file.is_open()){
-        cout << "Error opening file: " << filename << endl;
-        return;
+// Fills r from one clean reviews row (Product ID,Customer ID,Rating,Review Text)
+bool parseReviewRow(const CSVRow& row, Review& r){
+    if(row.getSize() < 4){
+        return false;
     }
 
-    string line;
-    getline(file, line); // Skip header line
-
-    while(getline(file, line)){
-        stringstream ss(line);
-        string customerID, product, priceStr, date, category, paymentMethod;
-
-        getline(ss, customerID, '|');
-        getline(ss, product, ',');
-        getline(ss, category, ',');
-        getline(ss, priceStr, ',');
-        getline(ss, date, ',');
-        getline(ss, paymentMethod, ',');
-
-        Transaction t;
-        t.customerID = customerID;
-        t.product = product;
-        t.category = category;
-        t.price = stod(priceStr); // Convert string to double
-        t.date = date;
-        t.paymentMethod = paymentMethod;
-
-        transactions.add(t);
+    uint8_t rating;
+    if(parseRating(row[2].ptr, row[2].len, rating) != NUM_OK){
+        return false;
     }
 
-    file.close();
+    r.productID = intern(row[0]);
+    r.customerID = intern(row[1]);
+    r.rating = rating;
+    r.reviewText = row[3].str();
+    return true;
 }
 
-void loadReviews(const string& filename, Array<Review>& reviews){
-    ifstream file(filename);
-
-    if(!file.is_open()){
+// Parsed by several threads over newline-aligned ranges of the clean file.
+// Records own their strings, so the loader's arena stays empty.
+void loadTransactions(const string& filename, Array<Transaction>& transactions){
+    Arena unused;
+    auto parse = [](const CSVRow& row, Transaction& t, Arena&){ return parseTransactionRow(row, t); };
+    if(parallelLoadCSV(filename.c_str(), transactions, parse, unused) < 0){
         cout << "Error opening file: " << filename << endl;
-        return;
     }
+}
 
-    string line;
-    getline(file, line); // Skip header line
-
-    while (getline(file, line)){
-        stringstream ss(line);
-        string productID, customerID, ratingStr, reviewText;
+// Serial: every node comes from the list's own NodePool, which is not
+// thread-safe
+void loadTransactions(const string& filename, LinkedList<Transaction>& transactions){
+    CSVReader file(filename.c_str());
 
-        getline(ss, productID, ',');
-        getline(ss, customerID, ',');
-        getline(ss, ratingStr, ',');
-        getline(ss, reviewText, ',');
+    if(!file.isOpen()){
+        cout << "Error opening file: " << filename << endl;
+        return;
+    }
 
-        Review r;
-        r.productID = productID;
-        r.customerID = customerID;
-        r.rating = stoi(ratingStr); // Convert string to int
-        r.reviewText = reviewText;
+    file.skipLine(); // Skip header line
 
-        reviews.add(r);
+    CSVRow row;
+    Transaction t;
+    while(file.nextRow(row)){
+        if(parseTransactionRow(row, t)){
+            transactions.add(t);
+        }
     }
+}
 
-    file.close();
+void loadReviews(const string& filename, Array<Review>& reviews){
+    Arena unused;
+    auto parse = [](const CSVRow& row, Review& r, Arena&){ return parseReviewRow(row, r); };
+    if(parallelLoadCSV(filename.c_str(), reviews, parse, unused) < 0){
+        cout << "Error opening file: " << filename << endl;
+    }
 }
 
+// Serial, like the transactions list
 void loadReviews(const string& filename, LinkedList<Review>& reviews){
-    ifstream file(filename);
+    CSVReader file(filename.c_str());
 
-    if(!file.is_open()){
+    if(!file.isOpen()){
         cout << "Error opening file: " << filename << endl;
         return;
     }
 
-    string line;
-    getline(file, line); // Skip header line
+    file.skipLine(); // Skip header line
 
-    while (getline(file, line)){
-        stringstream ss(line);
-        string productID, customerID, ratingStr, reviewText;
-
-        getline(ss, productID, ',');
-        getline(ss, customerID, ',');
-        getline(ss, ratingStr, ',');
-        getline(ss, reviewText, ',');
-
-        Review r;
-        r.productID = productID;
-        r.customerID = customerID;
-        r.rating = stoi(ratingStr); // Convert string to int
-        r.reviewText = reviewText;
-
-        reviews.add(r);
+    CSVRow row;
+    Review r;
+    while(file.nextRow(row)){
+        if(parseReviewRow(row, r)){
+            reviews.add(r);
+        }
     }
-
-    file.close();
 }
 
 void insertionSortByDate(Array<Transaction>& arr){
     int n = arr.getSize();
+    Transaction* a = arr.data(); // Unchecked access in the shifting loop
 
     for(int i = 1; i < n; i++){
-        Transaction key = arr.get(i);
+        Transaction key = std::move(a[i]);
         int j = i - 1;
 
-        //Move elements greater than key.date to one position ahead
-        while(j>= 0 && arr.get(j).date > key.date){
-            arr.get(j + 1) = arr.get(j);
+        //Move elements with a later date than key to one position ahead
+        while(j>= 0 && a[j].dateKey > key.dateKey){
+            a[j + 1] = std::move(a[j]);
             j--;
         }
-        arr.get(j + 1) = key;
+        a[j + 1] = std::move(key);
     }
 }
 
 void insertionSortByDate(LinkedList<Transaction>& list){
     using Node = LinkedList<Transaction>::Node;
 
-    Node* sorted = nullptr; // Start with an empty sorted list
+    // Everything before current is sorted. Walk back from current to the
+    // first node that is not later than it and splice current in after it;
+    // ties keep their order, as in the array version.
     Node* current = list.getHead();
-
     while(current != nullptr){
-        Node* next = current->next; // Store next before changing current->next
-        current->next = nullptr;
-
-        // Insert current into sorted list at the correct position
-        if(!sorted || current->data.date < sorted->data.date){
-            // Insert at head
-            current->next = sorted;
-            sorted = current;
-        }else{
-            Node* temp = sorted;
-            while(temp->next != nullptr && temp->next->data.date <current->data.date){
-                temp = temp->next;
-            }
-            current->next = temp->next;
-            temp->next = current;
+        Node* next = current->next;
+        Node* before = current->prev;
+
+        while(before != nullptr && before->data.dateKey > current->data.dateKey){
+            before = before->prev;
+        }
+        if(before != current->prev){
+            list.moveBefore(current, before ? before->next : list.getHead());
         }
-        current = next; // Move to the next node in the original list
+        current = next;
     }
-
-    // Update the original list's head and tail
-    list.setHead(sorted);
 }
 
 void sentinelLinearSearch(Array<Transaction>& arr){
     int n = arr.getSize();
 
     Transaction sentinel;
-    sentinel.category = "Electronics";
-    sentinel.paymentMethod = "Credit Card";
+    Symbol electronics = intern("Electronics");
+    Symbol creditCard = intern("Credit Card");
+    sentinel.category = electronics;
+    sentinel.paymentMethod = creditCard;
     arr.add(sentinel);
 
     int totalElectronics = 0;
@@ -298,9 +286,9 @@ void sentinelLinearSearch(Array<Transaction>& arr){
 
     int i = 0;
     for (int i = 0; i < n; i++) { // 🔁 only iterate up to n
-        if (arr.get(i).category == "Electronics") {
+        if (arr.get(i).category == electronics) {
             totalElectronics++;
-            if (arr.get(i).paymentMethod == "Credit Card") {
+            if (arr.get(i).paymentMethod == creditCard) {
                 creditCardElectronics++;
             }
         }
@@ -321,37 +309,49 @@ void sentinelLinearSearch(Array<Transaction>& arr){
 
 }
 
+// Reads 8 bytes per row (category and payment symbols), so no sentinel is
+// needed to keep the loop tight
+void linearSearch(const TransactionTable& table){
+    int creditCardElectronics = 0;
+    int totalElectronics = table.countCategory(intern("Electronics"), intern("Credit Card"), creditCardElectronics);
+
+    if(totalElectronics == 0){
+        cout << "No Electronics transactions found." << endl;
+        return;
+    }
+
+    double percent = (static_cast<double>(creditCardElectronics) / totalElectronics) * 100;
+
+    cout << "Total Electronics transactions: " << totalElectronics << endl;
+    cout << "Total Electronics transactions paid by Credit Card: " << creditCardElectronics << endl;
+    cout << "Percentage of Electronics transactions paid by Credit Card: " << percent << "%" << endl;
+}
+
 void sentinelLinearSearch(LinkedList<Transaction>& list){
     using Node = LinkedList<Transaction>::Node;
 
-    int originalSize = list.getSize();
-
-    // Create a sentinel transaction
+    // Create a sentinel transaction at the tail, so the scan needs no end check
     Transaction sentinel;
-    sentinel.category = "Electronics";
-    sentinel.paymentMethod = "Credit Card";
+    Symbol electronics = intern("Electronics");
+    Symbol creditCard = intern("Credit Card");
+    sentinel.category = electronics;
+    sentinel.paymentMethod = creditCard;
     list.add(sentinel);
+    Node* end = list.getTail();
 
     int totalElectronics = 0;
     int creditCardElectronics = 0;
 
-    Node* current = list.getHead();
-    int index = 0;
-
-    while(current != nullptr){
-        if(index == originalSize) break; // Stop before processing the sentinel
-
-        if(current->data.category == "Electronics"){
+    for(Node* current = list.getHead(); current != end; current = current->next){
+        if(current->data.category == electronics){
             totalElectronics++;
 
-            if(current->data.paymentMethod == "Credit Card"){
+            if(current->data.paymentMethod == creditCard){
                 creditCardElectronics++;
             }
         }
-        current = current->next;
-        index++;
     }
-    list.removeLast();
+    list.removeLast(); // O(1): the tail knows its predecessor
 
     if(totalElectronics == 0){
         cout << "No Electronics transactions found." << endl;
@@ -365,7 +365,7 @@ void sentinelLinearSearch(LinkedList<Transaction>& list){
     cout << "Percentage: " << percent << "%" << endl;
 }
 
-void sentinelLinearSearch1StarReviews(Array<Review>& reviews, Array<string>& words){
+void sentinelLinearSearch1StarReviews(Array<Review>& reviews, WordCountMap& words){
     int n = reviews.getSize();
 
     // Add a sentinel
@@ -377,11 +377,12 @@ void sentinelLinearSearch1StarReviews(Array<Review>& reviews, Array<string>& wor
     int i = 0;
     while(true){
         if (reviews.get(i).rating == 1){
-            stringstream ss(reviews.get(i).reviewText);
-            string word;
+            const string& text = reviews.get(i).reviewText;
+            WordTokenizer tokenizer(text.data(), text.size(), WordTokenizer::SPLIT_SPACE, WordTokenizer::KEEP_RAW);
+            WordToken word;
 
-            while(ss >> word){
-                words.add(word); // Add each word to the array
+            while(tokenizer.next(word)){
+                words.increment(word.ptr, word.len); // Count each word
             }
         }
 
@@ -392,30 +393,12 @@ void sentinelLinearSearch1StarReviews(Array<Review>& reviews, Array<string>& wor
     reviews.removeLast();
 }
 
-struct WordFrequency{
-    string word;
-    int count;
-};
-
-void insertionSortWords(Array<string>& words){
-    Array<WordFrequency> frequencies;
-
-    for(int i = 0; i < words.getSize(); i++){
-        string word = words.get(i);
-        bool found = false;
-
-        for(int j = 0; j < frequencies.getSize(); j++){
-            if(frequencies.get(j).word == word){
-                frequencies.get(j).count++;
-                found = true;
-                break;
-            }
-        }
-
-        if(!found){
-            WordFrequency wf = {word, 1};
-            frequencies.add(wf);
-        }
+void insertionSortWords(const WordCountMap& words, Array<WordFrequency>& frequencies){
+    // Word counts in order of first appearance
+    frequencies.reserve(words.getSize());
+    for(const WordCountMap::Entry& e : words){
+        WordFrequency wf = {string(e.word, e.length), static_cast<int>(e.count)};
+        frequencies.add(std::move(wf));
     }
 
     // Insertion sort
@@ -437,82 +420,48 @@ void insertionSortWords(Array<string>& words){
     }
 }
 
-void sentinelLinearSearch1StarReviews(LinkedList<Review>& reviews, LinkedList<string>& words){
+void sentinelLinearSearch1StarReviews(LinkedList<Review>& reviews, WordCountMap& words){
     using Node = LinkedList<Review>::Node;
     Node* current = reviews.getHead();
 
     while(current != nullptr){
         if(current->data.rating == 1){
-            stringstream ss(current->data.reviewText);
-            string word;
+            const string& text = current->data.reviewText;
+            WordTokenizer tokenizer(text.data(), text.size(), WordTokenizer::SPLIT_SPACE, WordTokenizer::KEEP_RAW);
+            WordToken word;
 
-            while(ss >> word){
-                words.add(word); // Add each word to the linked list
+            while(tokenizer.next(word)){
+                words.increment(word.ptr, word.len); // Count each word
             }
         }
         current = current->next;
     }
 }
 
-void insertionSortWords(LinkedList<string>& words){
-    LinkedList<WordFrequency> frequencies;
-
-    using WordNode = LinkedList<string>::Node;
-    WordNode* current = words.getHead();
-
-    // Count word frequencies
-    while(current != nullptr){
-        string word = current->data;
-        bool found = false;
-
-        using FreqNode = LinkedList<WordFrequency>::Node;
-        FreqNode* freqNode = frequencies.getHead();
-
-        while(freqNode != nullptr){
-            if(freqNode->data.word == word){
-                freqNode->data.count++;
-                found = true;
-                break;
-            }
-            freqNode = freqNode->next;
-        }
-
-        if(!found){
-            WordFrequency wf = {word, 1};
-            frequencies.add(wf);
-        }
-        
-        current = current->next;
-    
+void insertionSortWords(const WordCountMap& words, LinkedList<WordFrequency>& frequencies){
+    // Word counts in order of first appearance
+    for(const WordCountMap::Entry& e : words){
+        WordFrequency wf = {string(e.word, e.length), static_cast<int>(e.count)};
+        frequencies.add(wf);
     }
 
-    // Insertion sort
+    // Insertion sort, highest count first; equal counts keep their order
     using Node = LinkedList<WordFrequency>::Node;
-    Node* sorted = nullptr;
     Node* unsorted = frequencies.getHead();
 
     while(unsorted != nullptr){
-        Node* next = unsorted->next; // Store next before changing unsorted->next
-        unsorted->next = nullptr;
-
-        // Insert unsorted into sorted list at the correct position
-        if(!sorted || unsorted->data.count > sorted->data.count){
-            unsorted->next = sorted;
-            sorted = unsorted;
-        }else{
-            Node* temp = sorted;
-            while(temp->next && temp->next->data.count > unsorted->data.count){
-                temp = temp->next;
-            }
-            unsorted->next = temp->next;
-            temp->next = unsorted;
+        Node* next = unsorted->next;
+        Node* before = unsorted->prev;
+
+        while(before != nullptr && before->data.count < unsorted->data.count){
+            before = before->prev;
+        }
+        if(before != unsorted->prev){
+            frequencies.moveBefore(unsorted, before ? before->next : frequencies.getHead());
         }
         unsorted = next;
     }
 
-    // Update the original list's head and tail
-    frequencies.setHead(sorted);
-
     // Display top 10
     cout << "\nTop 10 words in 1-star reviews:" << endl;
     Node* top = frequencies.getHead();
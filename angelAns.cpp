@@ -1,11 +1,14 @@
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <chrono>
 #include "CustomString.hpp"
 #include "Transaction.hpp"
 #include "Review.hpp"
 #include "Algorithms.hpp"
+#include "CSVReader.hpp"
+#include "NumberParse.hpp"
+#include "WordTokenizer.hpp"
+#include "WordCountMap.hpp"
+#include "ParallelLoader.hpp"
 
 using namespace std;
 
@@ -22,20 +25,23 @@ WordFreq* wordList = nullptr;
 int wordCount = 0;
 int wordCapacity = 100;
 
-// Helper function to resize Transaction array
-void ensureTransactionCapacity() {
-    if (transactionCount >= transactionCapacity) {
-        transactionCapacity *= 2;
+// Words are counted in a hash map, then copied into wordList for sorting
+WordCountMap wordCounts;
+
+// Helper function to grow the Transaction array to fit extra more rows
+void ensureTransactionCapacity(int extra) {
+    if (transactionCount + extra > transactionCapacity) {
+        while (transactionCount + extra > transactionCapacity) transactionCapacity *= 2;
         Transaction* newArr = new Transaction[transactionCapacity];
         for (int i = 0; i < transactionCount; ++i) newArr[i] = transactions[i];
         delete[] transactions;
         transactions = newArr;
     }
 }
-// Helper function to resize Review array
-void ensureReviewCapacity() {
-    if (reviewCount >= reviewCapacity) {
-        reviewCapacity *= 2;
+// Helper function to grow the Review array to fit extra more rows
+void ensureReviewCapacity(int extra) {
+    if (reviewCount + extra > reviewCapacity) {
+        while (reviewCount + extra > reviewCapacity) reviewCapacity *= 2;
         Review* newArr = new Review[reviewCapacity];
         for (int i = 0; i < reviewCount; ++i) newArr[i] = reviews[i];
         delete[] reviews;
@@ -53,18 +59,21 @@ void ensureWordCapacity() {
     }
 }
 
+// Appends the alphanumeric characters of [begin, end) to out, lowercased
+void appendCleaned(const char* begin, const char* end, MyString &out) {
+    for (const char* p = begin; p < end; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (isalnum(c)) {
+            out.push_back(static_cast<char>(tolower(c)));
+        }
+    }
+}
+
 // Function to clean word: remove punctuation, lowercase
 MyString cleanWord(const MyString &word) {
     MyString result;
-    CharNode* current = word.head;
-    while (current) {
-        if (isalnum(current->data)) {
-            char lowered = tolower(current->data);
-            char str[2] = {lowered, '\0'};
-            result = result + MyString(str);
-        }
-        current = current->next;
-    }
+    result.reserve(word.size());
+    appendCleaned(word.begin(), word.end(), result);
     return result;
 }
 
@@ -74,8 +83,8 @@ int partition(Transaction arr[], int low, int high) {
     int i = (low - 1);
     
     for (int j = low; j <= high - 1; j++) {
-        // Compare dates using < operator
-        if (!(pivot.date < arr[j].date)) {
+        // Compare the packed YYYYMMDD date keys
+        if (arr[j].dateKey <= pivot.dateKey) {
             i++;
             swap(arr[i], arr[j]);
         }
@@ -98,8 +107,8 @@ void sortByDate(Transaction arr[], int n) {
     quickSort(arr, 0, n - 1);
 }
 
-// Binary search for a category (assumes sorted by category)
-bool binarySearchCategory(Transaction arr[], int n, const MyString &target) {
+// Binary search for a category symbol (assumes sorted by category symbol)
+bool binarySearchCategory(Transaction arr[], int n, Symbol target) {
     int left = 0, right = n - 1;
     while (left <= right) {
         int mid = (left + right) / 2;
@@ -110,46 +119,25 @@ bool binarySearchCategory(Transaction arr[], int n, const MyString &target) {
     return false;
 }
 
-void addWord(const MyString &w) {
-    for (int i = 0; i < wordCount; ++i) {
-        if (wordList[i].word == w) {
-            wordList[i].count++;
-            return;
-        }
+void addWord(const char* w, size_t len) {
+    wordCounts.increment(w, len);
+}
+
+// Copies the counted words into wordList, in order of first appearance
+void collectWords() {
+    wordCount = 0;
+    for (const WordCountMap::Entry& e : wordCounts) {
+        ensureWordCapacity();
+        wordList[wordCount++] = WordFreq(MyString(e.word, e.length), static_cast<int>(e.count));
     }
-    ensureWordCapacity();
-    wordList[wordCount++] = WordFreq(w, 1);
 }
 
 void processReviewText(const MyString& text) {
-    MyString word;
-    CharNode* curr = text.head;
-    while (curr) {
-        // Skip leading spaces
-        while (curr && isspace(curr->data)) {
-            curr = curr->next;
-        }
-        if (!curr) break;
-        
-        // Find end of word
-        CharNode* wordStart = curr;
-        while (curr && !isspace(curr->data)) {
-            curr = curr->next;
-        }
-        
-        // Create word
-        MyString currWord;
-        CharNode* temp = wordStart;
-        while (temp && temp != curr) {
-            char str[2] = {temp->data, '\0'};
-            currWord = currWord + MyString(str);
-            temp = temp->next;
-        }
-        
-        MyString cleaned = cleanWord(currWord);
-        if (!cleaned.empty()) {
-            addWord(cleaned);
-        }
+    // Words are split on spaces only; punctuation inside a word is dropped
+    WordTokenizer tokenizer(text.c_str(), text.size(), WordTokenizer::SPLIT_SPACE);
+    WordToken word;
+    while (tokenizer.next(word)) {
+        addWord(word.ptr, word.len);
     }
 }
 
@@ -182,66 +170,73 @@ void sortWordsByFrequency() {
     quickSortWordFreq(wordList, 0, wordCount - 1);
 }
 
+// Drops leading spaces and tabs from a field
+FieldView trimLeading(FieldView field) {
+    size_t start = 0;
+    while (start < field.size() && (field[start] == ' ' || field[start] == '\t')) start++;
+    return field.substr(start, field.size());
+}
+
+// Copies a field straight from the mapping; only a field with escaped
+// quotes goes through the unescaping str()
+MyString toMyString(const FieldView& field) {
+    if (!field.escaped) return MyString(field.ptr, field.len);
+    std::string text = field.str();
+    return MyString(text.data(), text.size());
+}
+
+// Fills t from one clean transactions row; false drops the row
+bool parseTransactionRow(const CSVRow& row, Transaction& t, Arena&) {
+    if (row.getSize() < 5) return false;
+    int64_t priceCents;
+    if (parsePriceCents(row[2].ptr, row[2].len, priceCents) != NUM_OK) return false;
+    uint32_t dateKey;
+    if (parseDateKey(row[3].ptr, row[3].len, dateKey) != NUM_OK) return false;
+
+    // Split by | first
+    long pipe_pos = row[0].find('|');
+    if (pipe_pos < 0) return false;
+    // Fields are assigned one by one so the date is copied only once
+    t.customerID = intern(row[0].substr(0, pipe_pos));
+    t.product = intern(row[0].substr(pipe_pos + 1, row[0].size()));
+    t.priceCents = priceCents;
+    t.date = toMyString(row[3]);
+    t.dateKey = dateKey;
+    t.category = intern(trimLeading(row[1]));  // Clean up any leading whitespace
+    t.paymentMethod = intern(trimLeading(row[4]));
+    return true;
+}
+
+bool parseReviewRow(const CSVRow& row, Review& r, Arena&) {
+    if (row.getSize() < 4) return false;
+    uint8_t rating;
+    if (parseRating(row[2].ptr, row[2].len, rating) != NUM_OK) return false;
+    r.productID = intern(row[0]);
+    r.customerID = intern(row[1]);
+    r.reviewText = toMyString(row[3]);
+    r.rating = rating;
+    return true;
+}
+
+// Rows are parsed in parallel into an Array, then moved into the hand-grown
+// arrays above, which are sized once for the whole file. The records own
+// their strings, so the loader's arena stays empty.
 void loadTransactions(const std::string &filename) {
-    std::ifstream file(filename);
-    std::string line;
-    getline(file, line); // Skip header
-    while (getline(file, line)) {
-        std::stringstream ss(line);
-        std::string customer, product, category, price, date, payment;
-        
-        // Split by | first
-        size_t pipe_pos = line.find('|');
-        if (pipe_pos != std::string::npos) {
-            customer = line.substr(0, pipe_pos);
-            std::string rest = line.substr(pipe_pos + 1);
-            
-            // Parse the rest with commas
-            std::stringstream ss_rest(rest);
-            getline(ss_rest, product, ',');
-            getline(ss_rest, category, ',');
-            getline(ss_rest, price, ',');
-            getline(ss_rest, date, ',');
-            getline(ss_rest, payment, '\n');
-            
-            // Clean up any whitespace
-            category = category.substr(category.find_first_not_of(" \t"));
-            payment = payment.substr(payment.find_first_not_of(" \t"));
-            
-            ensureTransactionCapacity();
-            transactions[transactionCount++] = Transaction(
-                MyString(customer.c_str()), 
-                MyString(product.c_str()), 
-                stod(price), 
-                MyString(date.c_str()), 
-                MyString(category.c_str()), 
-                MyString(payment.c_str())
-            );
-        }
-    }
-    file.close();
+    Array<Transaction> loaded;
+    Arena unused;
+    // Payment method takes the rest of the line
+    parallelLoadCSV(filename.c_str(), loaded, parseTransactionRow, unused, 0, nullptr, 5);
+    ensureTransactionCapacity(loaded.getSize());
+    for (int i = 0; i < loaded.getSize(); ++i) transactions[transactionCount++] = std::move(loaded[i]);
 }
 
 void loadReviews(const std::string &filename) {
-    std::ifstream file(filename);
-    std::string line;
-    getline(file, line); // Skip header
-    while (getline(file, line)) {
-        std::stringstream ss(line);
-        std::string pid, cid, rating, text;
-        getline(ss, pid, ',');
-        getline(ss, cid, ',');
-        getline(ss, rating, ',');
-        getline(ss, text, '\n');
-        ensureReviewCapacity();
-        reviews[reviewCount++] = Review(
-            MyString(pid.c_str()), 
-            MyString(cid.c_str()), 
-            MyString(text.c_str()), 
-            stoi(rating)
-        );
-    }
-    file.close();
+    Array<Review> loaded;
+    Arena unused;
+    // Review text takes the rest of the line
+    parallelLoadCSV(filename.c_str(), loaded, parseReviewRow, unused, 0, nullptr, 4);
+    ensureReviewCapacity(loaded.getSize());
+    for (int i = 0; i < loaded.getSize(); ++i) reviews[reviewCount++] = std::move(loaded[i]);
 }
 
 int main() {
@@ -267,13 +262,17 @@ int main() {
     cout << "Total Transactions: " << transactionCount << "\nTotal Reviews: " << reviewCount << endl;
 
     // Q2: Electronics category paid with Credit Card
+    // Symbols of values no row has are NO_SYMBOL, which never matches
+    const SymbolTable& symbols = globalSymbols();
+    Symbol electronics = symbols.find("Electronics"), electronicsSpaced = symbols.find("Electronics ");
+    Symbol creditCard = symbols.find("Credit Card"), creditCardSpaced = symbols.find("Credit Card ");
     int electronicsTotal = 0, electronicsCC = 0;
     for (int i = 0; i < transactionCount; ++i) {
-        if (transactions[i].category == "Electronics" || 
-            transactions[i].category == "Electronics ") {  // Handle potential trailing space
+        if (transactions[i].category == electronics || 
+            transactions[i].category == electronicsSpaced) {  // Handle potential trailing space
             electronicsTotal++;
-            if (transactions[i].paymentMethod == "Credit Card" || 
-                transactions[i].paymentMethod == "Credit Card ") {  // Handle potential trailing space
+            if (transactions[i].paymentMethod == creditCard || 
+                transactions[i].paymentMethod == creditCardSpaced) {  // Handle potential trailing space
                 electronicsCC++;
             }
         }
@@ -291,8 +290,8 @@ int main() {
     cout << "\n3. Word Frequency Analysis Performance:\n";
     auto start_q3 = std::chrono::high_resolution_clock::now();
     
-    // Clear word list first to ensure we're only counting words from 1-star reviews
-    wordCount = 0;
+    // Clear word counts first to ensure we're only counting words from 1-star reviews
+    wordCounts.clear();
     // Process all 1-star reviews
     for (int i = 0; i < reviewCount; ++i) {
         if (reviews[i].rating == 1) {
@@ -301,6 +300,7 @@ int main() {
     }
     
     // Sort words by frequency using quick sort O(n log n)
+    collectWords();
     sortWordsByFrequency();
     
     // Display the top 10 most frequent words
@@ -310,21 +310,6 @@ int main() {
         cout << wordList[i].word << ": " << wordList[i].count << " occurrences" << endl;
     }
 
-    // Sort wordList alphabetically by word for binary search
-    auto compareWords = [](const WordFreq& a, const WordFreq& b) {
-        return a.word < b.word;
-    };
-    // Simple insertion sort for alphabetic order (since STL is not allowed)
-    for (int i = 1; i < wordCount; ++i) {
-        WordFreq key = wordList[i];
-        int j = i - 1;
-        while (j >= 0 && wordList[j].word > key.word) {
-            wordList[j + 1] = wordList[j];
-            --j;
-        }
-        wordList[j + 1] = key;
-    }
-
     // Prompt user for a word to search
     cout << "\nEnter a word to search for its frequency in 1-star reviews: ";
     std::string searchInput;
@@ -333,21 +318,10 @@ int main() {
     MyString searchWord(searchInput.c_str());
     MyString cleanedSearch = cleanWord(searchWord);
 
-    // Binary search for the word
-    int left = 0, right = wordCount - 1, foundIdx = -1;
-    while (left <= right) {
-        int mid = left + (right - left) / 2;
-        if (wordList[mid].word == cleanedSearch) {
-            foundIdx = mid;
-            break;
-        } else if (wordList[mid].word < cleanedSearch) {
-            left = mid + 1;
-        } else {
-            right = mid - 1;
-        }
-    }
-    if (foundIdx != -1) {
-        cout << "'" << wordList[foundIdx].word << "' found with frequency: " << wordList[foundIdx].count << endl;
+    // Hash lookup of the word; no alphabetical sort needed
+    const WordCountMap::Entry* found = wordCounts.find(cleanedSearch.c_str(), cleanedSearch.size());
+    if (found != nullptr) {
+        cout << "'" << found->word << "' found with frequency: " << found->count << endl;
     } else {
         cout << "'" << searchInput << "' not found in 1-star reviews." << endl;
     }